@@ -0,0 +1,40 @@
+// Advent of Code Day 1
+// https://adventofcode.com/2025/day/1
+
+#include <cstdint>
+#include <filesystem>
+#include <print>
+#include <cstdlib>
+#include <chrono>
+
+#include "aoc/alloc_hooks.hpp"
+#include "aoc/input.hpp"
+#include "days/day01.hpp"
+
+int main(int argc, char** argv) {
+    const std::filesystem::path input_path =
+        (argc > 1)  ? std::filesystem::path{argv[1]}
+                    : std::filesystem::path{"../inputs/input_01.txt"};
+
+    auto input = aoc::Input::open(input_path);
+    if (!input) {
+        std::println(stderr, "{}", input.error());
+        return EXIT_FAILURE;
+    }
+
+    // the whole simulation runs while parsing, see day01::simulate
+    auto start_time = std::chrono::high_resolution_clock::now();
+    auto dial = day01::parse(input->text());
+    auto end_time = std::chrono::high_resolution_clock::now();
+    if (!dial) {
+        std::println(stderr, "{}", dial.error());
+        return EXIT_FAILURE;
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+
+    std::println("Part 1: {}", day01::part1(*dial));
+    std::println("Part 2: {}", day01::part2(*dial));
+    std::println("Simulation duration: {} microseconds", duration.count());
+
+    return EXIT_SUCCESS;
+}
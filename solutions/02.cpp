@@ -0,0 +1,42 @@
+// Advent of Code Day 2
+// https://adventofcode.com/2025/day/2
+
+#include <cstdint>
+#include <filesystem>
+#include <print>
+#include <cstdlib>
+#include <chrono>
+
+#include "aoc/alloc_hooks.hpp"
+#include "aoc/input.hpp"
+#include "days/day02.hpp"
+
+int main(int argc, char** argv) {
+    const std::filesystem::path input_path =
+        (argc > 1)  ? std::filesystem::path{argv[1]}
+                    : std::filesystem::path{"../inputs/input_02.txt"};
+
+    auto input = aoc::Input::open(input_path);
+    if (!input) {
+        std::println(stderr, "{}", input.error());
+        return EXIT_FAILURE;
+    }
+
+    auto ranges = day02::parse(input->text());
+    if (!ranges) {
+        std::println(stderr, "{}", ranges.error());
+        return EXIT_FAILURE;
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    const int64_t part1 = day02::part1(*ranges);
+    const int64_t part2 = day02::part2(*ranges);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time);
+
+    std::println("Part 1: {}", part1);
+    std::println("Part 2: {}", part2);
+    std::println("Search duration: {} microseconds", duration.count());
+
+    return EXIT_SUCCESS;
+}
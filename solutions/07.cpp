@@ -1,110 +1,110 @@
 // Advent of Code Day 7
 // https://adventofcode.com/2025/day/7
 
-#include <iomanip>
-#include <iostream>
+#include <array>
 #include <cstdint>
-#include <expected>
 #include <filesystem>
 #include <fstream>
+#include <iostream>
+#include <optional>
 #include <print>
+#include <span>
 #include <string>
 #include <string_view>
-#include <ranges>
-#include <array>
-#include <vector>
 #include <cstdlib>
-#include <charconv>
-#include <chrono>
-
-enum Tile {
-    Manifold = 1,
-    Empty = 0,
-    Splitter = -1
-};
 
-void printGrid(size_t width, size_t height, auto get_tile) {
-    for (size_t y = 0; y < height; ++y) {
-        for (size_t x = 0; x < width; ++x) {
-            std::print("{:3}", get_tile(y, x));
-        }
-        std::println("");
-    }
-}
+#include "aoc/alloc_hooks.hpp"
+#include "aoc/input.hpp"
+#include "aoc/parse.hpp"
+#include "days/day07.hpp"
 
 int main(int argc, char** argv) {
     const std::filesystem::path input_path =
         (argc > 1)  ? std::filesystem::path{argv[1]}
                     : std::filesystem::path{"../inputs/input_07.txt"};
 
-    std::ifstream input_file{input_path};
-    if (!input_file.is_open()) {
-        std::println(stderr, "Failed to open input file: {}", input_path.string());
-        return EXIT_FAILURE;
+    // Options:
+    //   --mod=M  part 2 modulo M (1 to 2^62) with one 64-bit counter per column, instead of
+    //            the exact count that grows wider as the manifold gets deeper
+    //   --edits=FILE apply splitter edits from FILE ("-" for stdin, one per line as they come):
+    //            "+y,x" adds a splitter at row y, column x (from 0), "-y,x" removes one, and
+    //            prints both answers after each
+    std::optional<uint64_t> modulus{};
+    std::optional<std::string> edits{};
+    for (int i = 2; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (arg.starts_with("--mod=")) {
+            auto m = aoc::parse_number<uint64_t>(arg.substr(6));
+            if (!m || *m == 0 || *m > uint64_t{1} << 62) {
+                std::println(stderr, "Invalid modulus: {}", arg);
+                return EXIT_FAILURE;
+            }
+            modulus = *m;
+        } else if (arg.starts_with("--edits=")) {
+            edits = std::string{arg.substr(8)};
+        } else {
+            std::println(stderr, "Unknown option: {}", arg);
+            return EXIT_FAILURE;
+        }
     }
-    constexpr char man{'S'};
-    constexpr char split{'^'};
 
-    // flat contiguous vector with reserved memory for faster access and fewer allocations,
-    // but dynamic to work with test and real input
-    constexpr size_t h{142};
-    constexpr size_t w{141};
-    std::vector<int64_t> grid{};
-    grid.reserve(h * w);
-    std::string line;
-    size_t width{0};
-    size_t height{0};
+    auto input = aoc::Input::open(input_path);
+    if (!input) {
+        std::println(stderr, "{}", input.error());
+        return EXIT_FAILURE;
+    }
 
-    // convert symbols to ints that can be added up to calculate part 2 later
-    while (getline(input_file, line)) {
-        if (line.empty()) continue;
-        if (width == 0) width = line.size();
+    auto manifold = day07::parse_grid(input->text());
+    if (!manifold) {
+        std::println(stderr, "{}", manifold.error());
+        return EXIT_FAILURE;
+    }
+    std::println("Grid loaded: {} cols x {} rows", manifold->width, manifold->height);
 
-        for (size_t c = 0; c < width; c++) {
-            int32_t t{Tile::Empty};
-            
-            if (line[c] == man) {
-                t = Tile::Manifold;
-            } else if (line[c] == split) {
-                t = Tile::Splitter;
+    if (edits) {
+        std::ifstream file;
+        if (*edits != "-") {
+            file.open(*edits);
+            if (!file) {
+                std::println(stderr, "Failed to open edits file: {}", *edits);
+                return EXIT_FAILURE;
             }
-            grid.push_back(t);
         }
-        height++;
-    }
-
-    std::println("Grid loaded: {} cols x {} rows", width, height);
-
-    // Helper lambda for 2D access 
-    auto at = [&](size_t y, size_t x) -> int64_t& {
-        return grid[y * width + x];
-    };
+        std::istream& in = *edits == "-" ? std::cin : file;
 
-    // printGrid(width, height, at);
-    int64_t part1{0};
-    for (auto [y, x] : std::views::cartesian_product(std::views::iota(0uz, height - 1), std::views::iota(0uz, width))) {
-        int64_t t = at(y, x);
-        if (t > Tile::Empty) {
-            if (at(y + 1, x) == Tile::Splitter) {
-                at(y + 1, x + 1) += t;
-                at(y + 1, x - 1) += t;
-                part1++;
-            } else {
-                at(y + 1, x) += t;
+        day07::IncrementalBeams beams{*manifold};
+        std::println("Part 1: {}", beams.splits());
+        std::println("Part 2: {}", day07::to_decimal(beams.paths()));
+        std::string line;
+        for (size_t number = 1; std::getline(in, line); ++number) {
+            if (line.empty()) continue;
+            std::array<size_t, 2> at;
+            const bool add = line.front() == '+';
+            if ((!add && line.front() != '-') || !aoc::parse_fixed(std::string_view{line}.substr(1), ',', std::span{at})) {
+                std::println(stderr, "Invalid edit on line {}: {} (expected +y,x or -y,x)", number, line);
+                return EXIT_FAILURE;
             }
+            auto changed = beams.set_splitter(at[0], at[1], add);
+            if (!changed) {
+                std::println(stderr, "Invalid edit on line {}: {}", number, changed.error());
+                return EXIT_FAILURE;
+            }
+            std::println("{}: part 1 {}, part 2 {} ({} rows recomputed)", line, beams.splits(),
+                         day07::to_decimal(beams.paths()), beams.rows_recomputed());
         }
+        return EXIT_SUCCESS;
     }
 
-    // std::println("Result\n");
-    // printGrid(width, height, at);
-    std::println("Part 1: {}", part1);
-
-    // Part 2: count how many different paths a beam can take
-    int64_t part2{0};
-    for (size_t x = 0; x < width; x++) {
-        part2 += at(height - 1, x);
+    // both parts come out of the same pass
+    if (modulus) {
+        const day07::Beams beams = day07::simulate_mod(*manifold, *modulus);
+        std::println("Part 1: {}", beams.splits);
+        std::println("Part 2: {} (mod {})", beams.paths, *modulus);
+    } else {
+        const day07::WideBeams beams = day07::simulate_wide(*manifold);
+        std::println("Part 1: {}", beams.splits);
+        std::println("Part 2: {}", day07::to_decimal(beams.paths));
     }
-    std::println("Part 2: {}", part2);
 
     return EXIT_SUCCESS;
 }
@@ -1,79 +1,60 @@
 // Advent of Code Day 9
 // https://adventofcode.com/2025/day/9
 
-#include <iomanip>
-#include <iostream>
 #include <cstdint>
-#include <expected>
 #include <filesystem>
-#include <fstream>
 #include <print>
-#include <string>
 #include <string_view>
-#include <ranges>
-#include <array>
 #include <vector>
 #include <cstdlib>
-#include <charconv>
-#include <numeric>
 #include <algorithm>
 
-struct Tile {
-    int64_t x;
-    int64_t y;
-};
-
-struct Box {
-    int64_t x, y, u, v; // min_x, min_y, max_x, max_y
-
-    // construct normalized box from two points
-    static Box from(Tile p1, Tile p2) {
-        return {
-            std::min(p1.x, p2.x), std::min(p1.y, p2.y),
-            std::max(p1.x, p2.x), std::max(p1.y, p2.y)
-        };
-    }
-
-    int64_t area() const { 
-        return (u - x + 1) * (v - y + 1); 
-    }
-};
+#include "aoc/alloc_hooks.hpp"
+#include "aoc/input.hpp"
+#include "days/day09.hpp"
 
 int main(int argc, char** argv) {
+    using namespace day09;
     const std::filesystem::path input_path =
         (argc > 1)  ? std::filesystem::path{argv[1]}
                     : std::filesystem::path{"../inputs/input_09.txt"};
 
-    std::ifstream input_file{input_path};
-    if (!input_file.is_open()) {
-        std::println(stderr, "Failed to open input file: {}", input_path.string());
+    // "hull" (default) solves part 1 on the staircases, "stream" with a parallel scan over
+    // all pairs; both never store all pairs. "pairs" is the original sort over every pair
+    const std::string_view engine = (argc > 2) ? std::string_view{argv[2]} : "hull";
+    if (engine != "hull" && engine != "stream" && engine != "pairs") {
+        std::println(stderr, "Unknown engine: {} (expected hull, stream or pairs)", engine);
         return EXIT_FAILURE;
     }
 
-    std::string line;
-    std::vector<Tile> tiles{};
-    tiles.reserve(500);
+    auto input = aoc::Input::open(input_path);
+    if (!input) {
+        std::println(stderr, "{}", input.error());
+        return EXIT_FAILURE;
+    }
 
-    Tile tile;
-    // read all tiles
-    while (getline(input_file, line)) {
-        if (line.empty()) continue;
-        auto [ptr, ec] = std::from_chars(line.data(), line.data() + line.size(), tile.x);
-        std::from_chars(ptr + 1, line.data() + line.size(), tile.y);
-        tiles.push_back(tile);
+    auto floor = day09::parse(input->text());
+    if (!floor) {
+        std::println(stderr, "{}", floor.error());
+        return EXIT_FAILURE;
     }
+    const auto& tiles = floor->tiles;
+    const auto& lines = floor->lines;
 
     if (tiles.empty()) return EXIT_SUCCESS;
-
-    std::vector<Box> lines;
-    std::vector<Box> pairs;
     size_t n = tiles.size();
 
-    // generate lines (pairwise in order + wrap around) as Boxes
-    for (size_t i = 0; i < n; ++i) {
-        lines.push_back(Box::from(tiles[i], tiles[(i + 1) % n]));
+    if (engine == "hull" || engine == "stream") {
+        std::println("Part 1: {}", engine == "hull" ? max_area_hull(tiles) : max_area_parallel(tiles));
+        if (auto area = largest_valid_area(tiles, EdgeSoA{lines})) {
+            std::println("Part 2: {}", *area);
+        }
+        return EXIT_SUCCESS;
     }
 
+    AOC_PHASE("day09/pairs");
+    std::vector<Box> pairs;
+
     // generate pairs (combinations) as Boxes and sort by area
     for (size_t i = 0; i < n; ++i) {
         for (size_t j = i + 1; j < n; ++j) {
@@ -87,17 +68,9 @@ int main(int argc, char** argv) {
     std::println("Part 1: {}", pairs[0].area());
 
     // Part 2: Find largest rectangle that does not overlap with any line's bounding box
+    AOC_PHASE_NEXT("day09/pairs-scan");
     for (const auto& rect : pairs) {
-        bool overlap = false;
-        
-        for (const auto& line : lines) {
-            if (line.x < rect.u && line.y < rect.v && line.u > rect.x && line.v > rect.y) {
-                overlap = true;
-                break;
-            }
-        }
-
-        if (!overlap) {
+        if (!overlaps_any(rect, lines)) {
             std::println("Part 2: {}", rect.area());
             break; 
         }
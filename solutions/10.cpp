@@ -1,368 +1,252 @@
 // Advent of Code Day 10
 // https://adventofcode.com/2025/day/10
 
-#include <iomanip>
-#include <iostream>
 #include <cstdint>
-#include <expected>
 #include <filesystem>
-#include <fstream>
 #include <print>
 #include <string>
 #include <string_view>
-#include <ranges>
-#include <array>
 #include <vector>
 #include <cstdlib>
-#include <charconv>
 #include <numeric>
 #include <algorithm>
-#include <deque>
-#include <cmath>
-#include <random>
-#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <thread>
+#include <chrono>
 
-struct Manual {
-    int16_t lights; // target bitmask
-    int16_t len;    // num lights
-    std::vector<std::vector<int16_t>> buttons;
-    std::vector<int64_t> joltages;
-};
+#include "aoc/alloc_hooks.hpp"
+#include "aoc/input.hpp"
+#include "aoc/parse.hpp"
+#include "days/day10.hpp"
 
-std::string getBinaryRep(int n, int len) {
-    std::string ans = "";
-    for (int i = len - 1; i >= 0; i--) {
-        // If i'th bit is set 
-        if (n&(1 << i)) ans += '1';
-        else ans += '0';
-    }
-    return ans;
-}
+int main(int argc, char** argv) {
+    using namespace day10;
 
-template<>
-struct std::formatter<Manual> : std::formatter<std::string> {
-    auto format(const Manual& m, std::format_context& ctx) const {
-        auto out = std::format_to(ctx.out(), "len: {} [", m.len);
-        out = std::format_to(out, "{}", getBinaryRep(m.lights, m.len));
-        out = std::format_to(out, "] ");
-        for (const auto& btn : m.buttons) {
-            out = std::format_to(out, "(");
-            for (size_t i = 0; i < btn.size(); ++i) {
-                if (i > 0) out = std::format_to(out, ",");
-                out = std::format_to(out, "{}", btn[i]);
+    const std::filesystem::path input_path =
+        (argc > 1)  ? std::filesystem::path{argv[1]}
+                    : std::filesystem::path{"../inputs/input_10.txt"};
+
+    // Options:
+    //   --p1=gf2|bfs   part 1 engine: linear algebra (default) or the original BFS (<= 16 lights)
+    //   --p2=exact|simplex|check
+    //                  part 2 engine: exact integer search (default, falls back to the simplex
+    //                  when it declines), the dual simplex alone, or both with a comparison
+    //   --threads=N    worker threads for solving manuals concurrently (default: all cores)
+    //   --bb-threads=N threads sharing the branch-and-bound of a single manual (default 1)
+    //   --timing[=N]   print the N (default 10) slowest manuals
+    //   --cache=FILE   reuse solutions of previously seen machines from FILE and add the new ones
+    std::string_view part1_engine{"gf2"};
+    std::string_view part2_engine{"exact"};
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned bb_threads{1};
+    size_t show_slowest{0};
+    std::optional<std::filesystem::path> cache_path{};
+    for (int i = 2; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (arg.starts_with("--p1=")) {
+            part1_engine = arg.substr(5);
+        } else if (arg.starts_with("--p2=")) {
+            part2_engine = arg.substr(5);
+        } else if (arg.starts_with("--threads=")) {
+            auto count = aoc::parse_number<unsigned>(arg.substr(10));
+            if (!count || *count == 0) {
+                std::println(stderr, "Invalid thread count: {}", arg);
+                return EXIT_FAILURE;
             }
-            out = std::format_to(out, ") ");
-        }
-        out = std::format_to(out, "{{");
-        for (size_t i = 0; i < m.joltages.size(); ++i) {
-            if (i > 0) out = std::format_to(out, ",");
-            out = std::format_to(out, "{}", m.joltages[i]);
+            threads = *count;
+        } else if (arg.starts_with("--bb-threads=")) {
+            auto count = aoc::parse_number<unsigned>(arg.substr(13));
+            if (!count || *count == 0) {
+                std::println(stderr, "Invalid thread count: {}", arg);
+                return EXIT_FAILURE;
+            }
+            bb_threads = *count;
+        } else if (arg.starts_with("--cache=")) {
+            cache_path = std::filesystem::path{arg.substr(8)};
+        } else if (arg == "--timing") {
+            show_slowest = 10;
+        } else if (arg.starts_with("--timing=")) {
+            auto count = aoc::parse_number<size_t>(arg.substr(9));
+            if (!count) {
+                std::println(stderr, "Invalid manual count: {}", arg);
+                return EXIT_FAILURE;
+            }
+            show_slowest = *count;
+        } else {
+            std::println(stderr, "Unknown option: {}", arg);
+            return EXIT_FAILURE;
         }
-        return std::format_to(out, "}}");
     }
-};
-
-// Solve Part 2 via simplex + branch-and-bound ILP
-// Minimize sum of button presses  
-int64_t solve_manual(const Manual& m) {
-    constexpr double INF = 1e100;
-    constexpr double EPS = 1e-9;
-
-    const int n = static_cast<int>(m.joltages.size());
-    const int vars = static_cast<int>(m.buttons.size());
-    const int rows = 2 * n + vars;
-
-    if (n == 0 || vars == 0) return 0;
-
-    std::vector<std::vector<double>> A(rows, std::vector<double>(vars + 1, 0.0));
-
-    // Button non-negativity: -x_i <= 0
-    for (int i = 0; i < vars; ++i) {
-        const int row = rows - i - 1;
-        A[row][i] = -1.0;
+    if (part1_engine != "gf2" && part1_engine != "bfs") {
+        std::println(stderr, "Unknown part 1 engine: {} (expected gf2 or bfs)", part1_engine);
+        return EXIT_FAILURE;
+    }
+    if (part2_engine != "exact" && part2_engine != "simplex" && part2_engine != "check") {
+        std::println(stderr, "Unknown part 2 engine: {} (expected exact, simplex or check)", part2_engine);
+        return EXIT_FAILURE;
     }
 
-    // Equality constraints for each counter
-    for (int i = 0; i < vars; ++i) {
-        for (int idx : m.buttons[i]) {
-            if (idx < 0 || idx >= n) continue;
-            A[idx][i] += 1.0;       // sum x <= c
-            A[idx + n][i] -= 1.0;   // -sum x <= -c
-        }
+    auto input = aoc::Input::open(input_path);
+    if (!input) {
+        std::println(stderr, "{}", input.error());
+        return EXIT_FAILURE;
     }
-    for (int i = 0; i < n; ++i) {
-        A[i][vars] = static_cast<double>(m.joltages[i]);
-        A[i + n][vars] = -static_cast<double>(m.joltages[i]);
+    auto file = parse(input->text());
+    if (!file) {
+        std::println(stderr, "{}", file.error());
+        return EXIT_FAILURE;
     }
+    const auto& manuals = (*file)->manuals;
 
-    auto simplex = [&](const std::vector<std::vector<double>>& A,
-                       const std::vector<double>& C,
-                       std::vector<double>& x) -> double {
-        const int mrows = static_cast<int>(A.size());
-        const int nvars = static_cast<int>(A[0].size()) - 1;
-
-        std::vector<int> N(nvars + 1), B(mrows);
-        for (int i = 0; i < nvars; ++i) N[i] = i;
-        N[nvars] = -1;
-        for (int i = 0; i < mrows; ++i) B[i] = nvars + i;
-
-        std::vector<std::vector<double>> D(mrows + 2, std::vector<double>(nvars + 2, 0.0));
-        for (int i = 0; i < mrows; ++i) {
-            for (int j = 0; j < nvars; ++j) D[i][j] = A[i][j];
-            D[i][nvars] = A[i][nvars];
-            D[i][nvars + 1] = -1.0;
-        }
-        for (int j = 0; j < nvars; ++j) D[mrows][j] = C[j];
-
-        for (int i = 0; i < mrows; ++i) {
-            std::swap(D[i][nvars], D[i][nvars + 1]);
-        }
-
-        D[mrows + 1][nvars] = 1.0;
-
-        auto pivot = [&](int r, int s) {
-            const double k = 1.0 / D[r][s];
-            for (int i = 0; i < mrows + 2; ++i) {
-                if (i == r) continue;
-                for (int j = 0; j < nvars + 2; ++j) {
-                    if (j == s) continue;
-                    D[i][j] -= D[r][j] * D[i][s] * k;
-                }
+    if (part1_engine == "bfs") {
+        for (const auto& man : manuals) {
+            if (man.len > 16) {
+                std::println(stderr, "BFS supports at most 16 lights, got {}", man.len);
+                return EXIT_FAILURE;
             }
-            for (int j = 0; j < nvars + 2; ++j) D[r][j] *= k;
-            for (int i = 0; i < mrows + 2; ++i) D[i][s] *= -k;
-            D[r][s] = k;
-            std::swap(B[r], N[s]);
-        };
-
-        auto find = [&](int p) -> bool {
-            while (true) {
-                int s = -1;
-                for (int i = 0; i < nvars + 1; ++i) {
-                    if (!p && N[i] == -1) continue;
-                    if (s == -1 || D[mrows + p][i] < D[mrows + p][s] - EPS ||
-                        (std::abs(D[mrows + p][i] - D[mrows + p][s]) <= EPS && N[i] < N[s])) {
-                        s = i;
-                    }
-                }
-                if (D[mrows + p][s] > -EPS) return true;
-
-                int r = -1;
-                for (int i = 0; i < mrows; ++i) {
-                    if (D[i][s] <= EPS) continue;
-                    double ratio = D[i][nvars + 1] / D[i][s];
-                    if (r == -1 || ratio < D[r][nvars + 1] / D[r][s] - EPS ||
-                        (std::abs(ratio - D[r][nvars + 1] / D[r][s]) <= EPS && B[i] < B[r])) {
-                        r = i;
-                    }
-                }
-                if (r == -1) return false;
-                pivot(r, s);
-            }
-        };
-
-        int r = 0;
-        for (int i = 1; i < mrows; ++i) {
-            if (D[i][nvars + 1] < D[r][nvars + 1]) r = i;
         }
+    }
 
-        if (D[r][nvars + 1] < -EPS) {
-            pivot(r, nvars);
-            if (!find(1) || D[mrows + 1][nvars + 1] < -EPS) return -INF;
-        }
-
-        for (int i = 0; i < mrows; ++i) {
-            if (B[i] == -1) {
-                int s = 0;
-                for (int j = 1; j < nvars; ++j) {
-                    if (D[i][j] < D[i][s] - EPS ||
-                        (std::abs(D[i][j] - D[i][s]) <= EPS && N[j] < N[s])) {
-                        s = j;
-                    }
-                }
-                pivot(i, s);
-            }
-        }
-
-        if (!find(0)) return -INF;
-
-        x.assign(nvars, 0.0);
-        for (int i = 0; i < mrows; ++i) {
-            if (0 <= B[i] && B[i] < nvars) x[B[i]] = D[i][nvars + 1];
+    // Per-manual cost varies by orders of magnitude, so the manuals are handed out through a
+    // work-stealing pool. Results land in per-manual slots and are summed in input order
+    // afterwards, which keeps the output independent of scheduling.
+    struct Result {
+        int32_t part1{0};
+        int64_t part2{0};
+        double part1_ms{0.0};
+        double part2_ms{0.0};
+        std::string fallback{};          // why the exact engine declined, if it did
+        std::optional<int64_t> simplex{}; // second opinion in check mode
+        bool reused{false};               // taken from the cache or an identical machine
+    };
+    std::vector<Result> results(manuals.size());
+    std::vector<Scratch> scratch(threads);
+
+    // Only the first of each group of structurally identical machines is solved, and none
+    // that the cache file already knows.
+    auto cache = cache_path ? load_cache(*cache_path) : std::unordered_map<std::string, CachedSolution>{};
+    std::vector<std::string> keys(manuals.size());
+    std::vector<size_t> source(manuals.size());
+    std::vector<size_t> todo;
+    {
+        std::unordered_map<std::string_view, size_t> first_seen;
+        for (size_t i = 0; i < manuals.size(); ++i) {
+            keys[i] = canonical_key(manuals[i]);
+            auto [it, inserted] = first_seen.try_emplace(keys[i], i);
+            source[i] = it->second;
+            if (inserted && !cache.contains(keys[i])) todo.push_back(i);
         }
+    }
 
-        double val = 0.0;
-        for (int i = 0; i < nvars; ++i) val += C[i] * x[i];
-        return val;
+    auto simplex = [&](const Manual& man, Scratch& s) {
+        return bb_threads > 1 ? solve_manual_parallel(man, bb_threads) : solve_manual(man, s);
     };
 
-    const std::vector<double> C(vars, 1.0);
-    double best = INF;
-
-    std::function<void(const std::vector<std::vector<double>>&)> branch;
-    branch = [&](const std::vector<std::vector<double>>& curA) {
-        std::vector<double> x;
-        double val = simplex(curA, C, x);
-        if (val == -INF || val + EPS >= best) return;
-
-        int k = -1;
-        double v = 0.0;
-        for (int i = 0; i < vars; ++i) {
-            double r = std::round(x[i]);
-            if (std::abs(x[i] - r) > EPS) {
-                k = i;
-                v = std::floor(x[i]);
-                break;
+    parallel_for_stealing(todo.size(), threads, [&](size_t task, unsigned worker) {
+        using clock = std::chrono::steady_clock;
+        const size_t i = todo[task];
+        const Manual& man = manuals[i];
+        Result& res = results[i];
+
+        auto t0 = clock::now();
+        std::optional<int32_t> presses{};
+        if (part1_engine == "gf2") {
+            button_masks(man, scratch[worker].masks);
+            presses = min_presses_gf2(scratch[worker].masks, man.lights, man.len);
+        } else {
+            presses = min_presses_bfs(man);
+        }
+        res.part1 = presses.value_or(0); // unreachable lights contribute nothing
+
+        // Part 2: Linear Equations. Joltages are counters that need to be reached by button presses
+        auto t1 = clock::now();
+        if (part2_engine == "simplex") {
+            res.part2 = simplex(man, scratch[worker]);
+        } else {
+            auto exact = solve_manual_exact(man, scratch[worker]);
+            if (exact) {
+                res.part2 = *exact;
+            } else {
+                res.fallback = exact.error();
+                res.part2 = simplex(man, scratch[worker]);
             }
+            if (part2_engine == "check") res.simplex = simplex(man, scratch[worker]);
         }
-
-        if (k == -1) {
-            best = val;
-            return;
+        auto t2 = clock::now();
+
+        res.part1_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        res.part2_ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    });
+
+    size_t reused{0};
+    for (size_t i = 0; i < manuals.size(); ++i) {
+        Result& res = results[i];
+        if (auto hit = cache.find(keys[i]); hit != cache.end()) {
+            res.part1 = hit->second.part1;
+            res.part2 = hit->second.part2;
+            res.reused = true;
+        } else if (source[i] != i) {
+            res.part1 = results[source[i]].part1;
+            res.part2 = results[source[i]].part2;
+            res.reused = true;
         }
-
-        std::vector<double> s(vars + 1, 0.0);
-        s[k] = 1.0;
-        s[vars] = v;
-        auto leftA = curA;
-        leftA.push_back(s);
-        branch(leftA);
-
-        s[k] = -1.0;
-        s[vars] = -v - 1.0;
-        auto rightA = curA;
-        rightA.push_back(s);
-        branch(rightA);
-    };
-
-    branch(A);
-    return static_cast<int64_t>(std::llround(best));
-}
-
-int main(int argc, char** argv) {
-    const std::filesystem::path input_path =
-        (argc > 1)  ? std::filesystem::path{argv[1]}
-                    : std::filesystem::path{"../inputs/input_10.txt"};
-
-    std::ifstream input_file{input_path};
-    if (!input_file.is_open()) {
-        std::println(stderr, "Failed to open input file: {}", input_path.string());
-        return EXIT_FAILURE;
+        if (res.reused) reused++;
     }
-        std::vector<Manual> manuals{};
-    manuals.reserve(200);
-    std::string line;
-
-    // Parsing
-    while (getline(input_file, line)) {
-        if (line.empty()) continue;
-        Manual man{};
-        auto pos = line.find(' ');
 
-        constexpr char on{'#'};
-
-        // Parse lights into bitmask for Part 1
-        man.lights = 0;
-        man.len = pos - 2;
-        for (size_t i = 1; i < pos - 1; i++) {
-            if (line[i] == on) {
-                man.lights = man.lights | (1 << (man.len - i));
-            }
+    if (cache_path) {
+        for (size_t i : todo) cache.insert_or_assign(keys[i], CachedSolution{results[i].part1, results[i].part2});
+        if (!save_cache(*cache_path, cache)) {
+            std::println(stderr, "Failed to write cache file: {}", cache_path->string());
         }
-
-        auto prev_pos = pos + 1;
-        pos = line.find(' ', prev_pos);
-
-        // Helper to parse comma-separated lists "(1,2,3)" or "{1,2,3}"
-        auto parse_indices = []<typename T>(std::string_view sv) -> std::vector<T> {
-            std::vector<T> result;
-            const char* ptr = sv.data() + 1; // skip ( or {
-            const char* end = sv.data() + sv.size() - 1; // skip ) or }
-
-            while (ptr < end) {
-                T val; 
-                auto [next_ptr, ec] = std::from_chars(ptr, end, val);
-                if (ec == std::errc()) {
-                    result.push_back(val);
-                    ptr = next_ptr;
-                    if (ptr < end && *ptr == ',') ptr++;
-                } else break;
-            }
-            return result;
-        };
-
-        // Parse buttons: (1,3) (2) ...
-        while (pos != std::string::npos) {
-            std::string_view chunk(line.data() + prev_pos, pos - prev_pos);
-            man.buttons.push_back(parse_indices.operator()<int16_t>(chunk));
-            
-            prev_pos = pos + 1;
-            pos = line.find(' ', prev_pos);
-        }
-
-        // Parse joltages: {3,5,4,7}
-        std::string_view last(line.data() + prev_pos, line.size() - prev_pos);
-        man.joltages = parse_indices.operator()<int64_t>(last); 
-
-        manuals.push_back(man);
     }
 
-    // Part 1: BFS with XOR
     int32_t part1{0};
-    for (const auto& man : manuals) {
-        if (man.lights == 0) continue; // Part 1 only cares about getting lights to 0
-
-        std::vector<bool> visited(65536, false);
-        std::deque<int16_t> q;
-        
-        q.push_back(0);
-        visited[0] = true;
-
-        int16_t presses{0};
-        bool found{false};
-
-        while (!found && !q.empty()) {
-            presses++;
-            size_t in_q = q.size();
-            while (in_q--) {
-                int16_t curr = q.front();
-                q.pop_front();
-
-                for (const auto& btn_indices : man.buttons) {
-                    // Convert Indices back to Mask
-                    int16_t btn_mask = 0;
-                    for (int idx : btn_indices) {
-                        if (idx < man.len) // Safety check
-                            btn_mask |= (1 << (man.len - idx - 1));
-                    }
-
-                    int16_t next_state = curr ^ btn_mask;
-                    if (next_state == man.lights) {
-                        found = true;
-                        part1 += presses;
-                        break;
-                    }
-
-                    if (!visited[next_state]) {
-                        visited[next_state] = true;
-                        q.push_back(next_state);
-                    }
-                }
-                if (found) break;
+    int64_t part2{0};
+    size_t mismatches{0};
+    size_t fallbacks{0};
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& res = results[i];
+        part1 += res.part1;
+        part2 += res.part2;
+        if (!res.fallback.empty()) {
+            fallbacks++;
+            if (part2_engine == "check") {
+                std::println(stderr, "Line {}: exact engine declined ({}), used simplex", manuals[i].line, res.fallback);
             }
         }
+        if (res.simplex && *res.simplex != res.part2) {
+            std::println(stderr, "Line {}: exact {} != simplex {}", manuals[i].line, res.part2, *res.simplex);
+            mismatches++;
+        }
     }
     std::println("Part 1: {}", part1);
+    std::println("Part 2: {}", part2);
 
-    // Part 2: Linear Equations. Joltages are counters that need to be reached by button presses
-    int64_t part2{0};
-    for (const auto& man : manuals) {
-        int64_t t = solve_manual(man);
-        // std::println("{}\nPresses for Joltages {}", man, t);
-        part2 += t;
+    if (show_slowest > 0) {
+        std::vector<size_t> order(manuals.size());
+        std::iota(order.begin(), order.end(), 0);
+        auto total = [&](size_t i) { return results[i].part1_ms + results[i].part2_ms; };
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return total(a) > total(b); });
+        order.resize(std::min(show_slowest, order.size()));
+
+        std::println("Slowest manuals ({} threads):", threads);
+        for (size_t i : order) {
+            std::println("  line {:>5}: {:9.3f} ms (part 1 {:.3f} ms, part 2 {:.3f} ms), {} buttons, {} counters",
+                         manuals[i].line, total(i), results[i].part1_ms, results[i].part2_ms,
+                         manuals[i].button_count(), manuals[i].joltages.size());
+        }
     }
 
-    std::println("Part 2: {}", part2);
+    if (cache_path || show_slowest > 0) {
+        std::println("Solved {} of {} manuals, {} reused from the cache or identical machines",
+                     todo.size(), manuals.size(), reused);
+    }
+
+    if (part2_engine == "check") {
+        std::println("Cross-check: {} of {} manuals differ, {} solved by simplex only",
+                     mismatches, manuals.size(), fallbacks);
+    }
 
-    return EXIT_SUCCESS;
+    return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,63 @@
+// Global operator new/delete replacements that charge every heap allocation to the open probe
+// phases, see probe.hpp. They only exist in builds with -DAOC_PROBE_ALLOC; otherwise this
+// header is empty. Replacements must be defined once per program, so only the file with
+// main() includes it.
+
+#pragma once
+
+#include "probe.hpp"
+
+#if defined(AOC_PROBE_ALLOC)
+
+#include <cstddef>
+#include <new>
+
+namespace aoc::probe::detail {
+
+inline void* hooked_new(std::size_t size, std::size_t align) {
+    void* p = tracked_allocate(size, align);
+    if (p == nullptr) throw std::bad_alloc{};
+    return p;
+}
+
+} // namespace aoc::probe::detail
+
+void* operator new(std::size_t size) {
+    return aoc::probe::detail::hooked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new[](std::size_t size) {
+    return aoc::probe::detail::hooked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new(std::size_t size, std::align_val_t align) {
+    return aoc::probe::detail::hooked_new(size, static_cast<std::size_t>(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return aoc::probe::detail::hooked_new(size, static_cast<std::size_t>(align));
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return aoc::probe::detail::tracked_allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return aoc::probe::detail::tracked_allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return aoc::probe::detail::tracked_allocate(size, static_cast<std::size_t>(align));
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return aoc::probe::detail::tracked_allocate(size, static_cast<std::size_t>(align));
+}
+
+void operator delete(void* p) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete[](void* p) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { aoc::probe::detail::tracked_deallocate(p); }
+
+#endif
@@ -0,0 +1,38 @@
+// Inputs built into the binary, so a fixed dataset can be solved at compile time.
+//
+// A build picks the input with one of
+//   -DAOC_EMBED='"input.txt"'               the file itself, through C++26 #embed
+//   -DAOC_EMBED_HEADER='"input_embed.hpp"'  a header written by bench/aoc_embed, for compilers
+//                                           without #embed
+// and gets it as aoc::embedded_bytes, a NUL-terminated char array, and aoc::embedded_input, a
+// string_view of it; AOC_EMBEDDED is defined in either case. #embed yields the bytes as int
+// constants, so that path takes ASCII inputs only.
+//
+// Solving a full-size input in the compiler takes more steps than the default constant
+// evaluation limits allow: raise them with -fconstexpr-ops-limit= and -fconstexpr-loop-limit=
+// on GCC, or -fconstexpr-steps= on clang.
+
+#pragma once
+
+#include <string_view>
+
+#if defined(AOC_EMBED_HEADER)
+
+#include AOC_EMBED_HEADER
+#define AOC_EMBEDDED 1
+
+#elif defined(AOC_EMBED)
+
+namespace aoc {
+
+inline constexpr char embedded_bytes[] = {
+#embed AOC_EMBED suffix(,)
+    '\0'};
+
+inline constexpr std::string_view embedded_input{embedded_bytes, sizeof(embedded_bytes) - 1};
+
+} // namespace aoc
+
+#define AOC_EMBEDDED 1
+
+#endif
@@ -0,0 +1,351 @@
+// Shared input layer for the C++ solutions.
+//
+// Regular files are memory-mapped privately, so the whole input is one contiguous buffer
+// the solutions can view (and even patch) in place without copying lines into strings.
+// Pipes, terminals and stdin ("-") fall back to one buffered read into an owned string.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <expected>
+#include <filesystem>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AOC_INPUT_MMAP 1
+#else
+#include <fstream>
+#include <iostream>
+#define AOC_INPUT_MMAP 0
+#endif
+
+namespace aoc {
+
+// Lines of a text without their terminator ("\n" or "\r\n"). A trailing newline does not
+// produce an extra empty line, blank lines inside the text are kept. Usable in constant
+// expressions, for inputs embedded at compile time (see embed.hpp).
+class Lines : public std::ranges::view_interface<Lines> {
+public:
+    class iterator {
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        constexpr explicit iterator(std::string_view text) : rest_{text} { next(); }
+
+        constexpr std::string_view operator*() const { return line_; }
+        constexpr iterator& operator++() { next(); return *this; }
+        constexpr iterator operator++(int) { auto copy = *this; next(); return copy; }
+
+        constexpr bool operator==(const iterator& other) const {
+            return at_end_ == other.at_end_ && (at_end_ || line_.data() == other.line_.data());
+        }
+        constexpr bool operator==(std::default_sentinel_t) const { return at_end_; }
+
+    private:
+        constexpr void next() {
+            if (rest_.empty()) {
+                at_end_ = true;
+                return;
+            }
+            const size_t eol = rest_.find('\n');
+            line_ = rest_.substr(0, eol);
+            rest_.remove_prefix(eol == std::string_view::npos ? rest_.size() : eol + 1);
+            if (!line_.empty() && line_.back() == '\r') line_.remove_suffix(1);
+            at_end_ = false;
+        }
+
+        std::string_view rest_{};
+        std::string_view line_{};
+        bool at_end_{true};
+    };
+
+    Lines() = default;
+    constexpr explicit Lines(std::string_view text) : text_{text} {}
+
+    constexpr iterator begin() const { return iterator{text_}; }
+    constexpr std::default_sentinel_t end() const { return {}; }
+
+private:
+    std::string_view text_{};
+};
+
+// Fields of a line separated by runs of sep, so "  12   7 " yields "12" and "7". The position
+// of a field in its line is field.data() - line.data().
+class Fields : public std::ranges::view_interface<Fields> {
+public:
+    class iterator {
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        iterator(std::string_view text, char sep) : rest_{text}, sep_{sep} { next(); }
+
+        std::string_view operator*() const { return field_; }
+        iterator& operator++() { next(); return *this; }
+        iterator operator++(int) { auto copy = *this; next(); return copy; }
+
+        bool operator==(const iterator& other) const {
+            return at_end_ == other.at_end_ && (at_end_ || field_.data() == other.field_.data());
+        }
+        bool operator==(std::default_sentinel_t) const { return at_end_; }
+
+    private:
+        void next() {
+            const size_t start = rest_.find_first_not_of(sep_);
+            if (start == std::string_view::npos) {
+                at_end_ = true;
+                return;
+            }
+            rest_.remove_prefix(start);
+            field_ = rest_.substr(0, rest_.find(sep_));
+            rest_.remove_prefix(field_.size());
+            at_end_ = false;
+        }
+
+        std::string_view rest_{};
+        std::string_view field_{};
+        char sep_{' '};
+        bool at_end_{true};
+    };
+
+    Fields() = default;
+    Fields(std::string_view line, char sep) : line_{line}, sep_{sep} {}
+
+    iterator begin() const { return iterator{line_, sep_}; }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    std::string_view line_{};
+    char sep_{' '};
+};
+
+constexpr Lines lines(std::string_view text) { return Lines{text}; }
+inline Fields fields(std::string_view line, char sep = ' ') { return Fields{line, sep}; }
+
+// Number of lines lines(text) yields, for sizing containers before parsing
+inline size_t line_count(std::string_view text) {
+    const auto newlines = static_cast<size_t>(std::ranges::count(text, '\n'));
+    return newlines + (!text.empty() && text.back() != '\n' ? 1 : 0);
+}
+
+// Rectangular character grid addressed in place: row y starts at y * stride, where the
+// stride covers the row and its line terminator. Grid can edit cells, GridView only reads.
+template <typename Char>
+struct BasicGrid {
+    std::span<Char> cells;
+    size_t width{0};
+    size_t height{0};
+    size_t stride{0};
+
+    Char& operator()(size_t y, size_t x) const { return cells[y * stride + x]; }
+    std::string_view row(size_t y) const { return {cells.data() + y * stride, width}; }
+};
+
+using Grid = BasicGrid<char>;
+using GridView = BasicGrid<const char>;
+
+// Views bytes as a grid. Every line must have the width and terminator of the first one,
+// trailing blank lines are ignored.
+template <typename Char>
+std::expected<BasicGrid<Char>, std::string> make_grid(std::span<Char> bytes) {
+    std::string_view text{bytes.data(), bytes.size()};
+    while (!text.empty() && (text.back() == '\n' || text.back() == '\r')) text.remove_suffix(1);
+    if (text.empty()) {
+        return std::unexpected("empty grid");
+    }
+
+    BasicGrid<Char> grid{bytes, text.find('\n'), 0, 0};
+    if (grid.width == std::string_view::npos) {
+        grid.width = text.size();
+        grid.stride = text.size() + 1;
+    } else {
+        grid.stride = grid.width + 1;
+        if (grid.width > 0 && text[grid.width - 1] == '\r') grid.width--;
+    }
+
+    const std::string_view terminator = text.substr(grid.width, grid.stride - grid.width);
+    grid.height = (text.size() + grid.stride - grid.width) / grid.stride;
+    if ((grid.height - 1) * grid.stride + grid.width != text.size()) {
+        return std::unexpected("rows have different widths");
+    }
+    for (size_t y = 0; y < grid.height; y++) {
+        const bool last = y + 1 == grid.height;
+        if (grid.row(y).find('\n') != std::string_view::npos
+            || (!last && text.substr(y * grid.stride + grid.width, terminator.size()) != terminator)) {
+            return std::unexpected("rows have different widths");
+        }
+    }
+    return grid;
+}
+
+inline std::expected<GridView, std::string> make_grid(std::string_view text) {
+    return make_grid(std::span<const char>{text.data(), text.size()});
+}
+
+namespace detail {
+
+#if AOC_INPUT_MMAP
+// Appends the rest of fd to buffer. A regular file is read into one block of its size,
+// anything else in 64 KiB steps.
+inline bool read_all(int fd, std::string& buffer, size_t size_hint) {
+    constexpr size_t chunk = size_t{1} << 16;
+    size_t used = buffer.size();
+    buffer.resize(used + (size_hint > 0 ? size_hint + 1 : chunk)); // + 1 to see the end without growing
+    for (;;) {
+        if (used == buffer.size()) buffer.resize(used + chunk);
+        const ssize_t got = ::read(fd, buffer.data() + used, buffer.size() - used);
+        if (got < 0) {
+            buffer.resize(used);
+            return false;
+        }
+        if (got == 0) break;
+        used += static_cast<size_t>(got);
+    }
+    buffer.resize(used);
+    return true;
+}
+#endif
+
+} // namespace detail
+
+// Reads path into buffer, replacing its contents but keeping its capacity: a caller going
+// through many files reuses one buffer and only allocates for a file larger than all before.
+// Small files are also cheaper to read than to map and unmap.
+inline std::expected<std::string_view, std::string> read_file(const std::filesystem::path& path, std::string& buffer) {
+    buffer.clear();
+#if AOC_INPUT_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return std::unexpected("Failed to open input file: " + path.string());
+    }
+    struct stat st{};
+    const bool regular = ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+    const bool read = detail::read_all(fd, buffer, regular ? static_cast<size_t>(st.st_size) : 0);
+    ::close(fd);
+    if (!read) {
+        return std::unexpected("Failed to read input file: " + path.string());
+    }
+#else
+    std::ifstream file{path, std::ios::binary};
+    if (!file.is_open()) {
+        return std::unexpected("Failed to open input file: " + path.string());
+    }
+    buffer.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+#endif
+    return std::string_view{buffer};
+}
+
+class Input {
+public:
+    // Maps path or reads it when it is not a regular file; "-" reads stdin
+    static std::expected<Input, std::string> open(const std::filesystem::path& path) {
+        Input input;
+        const bool from_stdin = path == "-";
+#if AOC_INPUT_MMAP
+        const int fd = from_stdin ? STDIN_FILENO : ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return std::unexpected("Failed to open input file: " + path.string());
+        }
+
+        struct stat st{};
+        const bool regular = ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+        if (regular && st.st_size > 0) {
+            // private and writable: untouched pages stay shared with the page cache,
+            // a solution that edits its input only copies the pages it writes to
+            void* data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                ::madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+                ::madvise(data, static_cast<size_t>(st.st_size), MADV_WILLNEED);
+                input.data_ = static_cast<char*>(data);
+                input.size_ = static_cast<size_t>(st.st_size);
+                input.mapped_ = true;
+            }
+        }
+
+        if (!input.mapped_) {
+            if (!detail::read_all(fd, input.buffer_, regular ? static_cast<size_t>(st.st_size) : 0)) {
+                if (!from_stdin) ::close(fd);
+                return std::unexpected("Failed to read input file: " + path.string());
+            }
+            input.adopt_buffer();
+        }
+        if (!from_stdin) ::close(fd);
+#else
+        std::ifstream file;
+        if (!from_stdin) {
+            file.open(path, std::ios::binary);
+            if (!file.is_open()) {
+                return std::unexpected("Failed to open input file: " + path.string());
+            }
+        }
+        std::istream& in = from_stdin ? std::cin : file;
+        input.buffer_.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+        input.adopt_buffer();
+#endif
+        return input;
+    }
+
+    Input() = default;
+    Input(const Input&) = delete;
+    Input& operator=(const Input&) = delete;
+
+    Input(Input&& other) noexcept { *this = std::move(other); }
+
+    Input& operator=(Input&& other) noexcept {
+        if (this != &other) {
+            release();
+            mapped_ = std::exchange(other.mapped_, false);
+            size_ = std::exchange(other.size_, 0);
+            buffer_ = std::move(other.buffer_);
+            data_ = mapped_ ? std::exchange(other.data_, nullptr) : buffer_.data();
+            other.data_ = nullptr;
+        }
+        return *this;
+    }
+
+    ~Input() { release(); }
+
+    std::string_view text() const { return {data_, size_}; }
+    std::span<char> bytes() { return {data_, size_}; }
+    bool mapped() const { return mapped_; }
+
+    Lines lines() const { return Lines{text()}; }
+    std::expected<Grid, std::string> grid() { return make_grid(bytes()); }
+
+private:
+    void adopt_buffer() {
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+    }
+
+    void release() {
+#if AOC_INPUT_MMAP
+        if (mapped_) ::munmap(data_, size_);
+#endif
+        mapped_ = false;
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    char* data_{nullptr};
+    size_t size_{0};
+    bool mapped_{false};
+    std::string buffer_;
+};
+
+} // namespace aoc
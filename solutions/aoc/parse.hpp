@@ -0,0 +1,306 @@
+// Shared integer parsing for the solutions.
+//
+// Digit runs are found and converted eight bytes at a time (SWAR): one 64-bit load tells
+// which of the next eight characters are digits, and three multiply-shift steps turn eight
+// digits into their value. Long runs of a separator (the column padding in Day 6) are
+// skipped sixteen bytes at a time with SSE2 where available. Every failure is reported
+// instead of leaving a default value behind like an unchecked std::from_chars.
+//
+// bench/parse.cpp compares this with the from_chars loops it replaced. SWAR pays off from
+// about five digits on; for the one to four digit numbers of Days 6 and 10 the predicted
+// byte loop of from_chars is still ahead.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <format>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace aoc {
+
+namespace detail {
+
+inline constexpr bool swar = std::endian::native == std::endian::little;
+
+inline uint64_t load8(const char* p) {
+    uint64_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+    return chunk;
+}
+
+// high bit set in every byte of chunk that is not an ASCII digit
+inline uint64_t nondigit_mask(uint64_t chunk) {
+    const uint64_t values = chunk ^ 0x3030303030303030; // digits become 0..9
+    return (((values & 0x7F7F7F7F7F7F7F7F) + 0x7676767676767676) | values) & 0x8080808080808080;
+}
+
+// up to eight bytes at p; missing bytes read as zero, which is not a digit, so a number
+// at the very end of a line or buffer still ends inside the chunk
+inline uint64_t load_upto8(const char* p, size_t available) {
+    if (available >= 8) return load8(p);
+    uint64_t chunk{0};
+    for (size_t i = 0; i < available; i++) chunk |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+    return chunk;
+}
+
+// value of eight digit values, the first character in the lowest byte
+inline uint64_t parse8(uint64_t values) {
+    values = (values * 10 + (values >> 8)) & 0x00FF00FF00FF00FF;
+    values = (values * 100 + (values >> 16)) & 0x0000FFFF0000FFFF;
+    return (values * 10000 + (values >> 32)) & 0xFFFFFFFF;
+}
+
+// value of 1 <= count <= 8 digits at p, reading 8 bytes when they are in bounds
+inline uint64_t parse_block(const char* p, size_t count, bool can_load8) {
+    if (swar && can_load8) {
+        // push the digits to the top bytes so the missing ones act as leading zeros
+        return parse8((load8(p) - 0x3030303030303030) << (8 * (8 - count)));
+    }
+    uint64_t value{0};
+    for (size_t i = 0; i < count; i++) value = value * 10 + static_cast<uint64_t>(p[i] - '0');
+    return value;
+}
+
+} // namespace detail
+
+// Number of ASCII digits at the start of text
+inline size_t digit_run(std::string_view text) {
+    size_t n{0};
+    if constexpr (detail::swar) {
+        for (; n + 8 <= text.size(); n += 8) {
+            if (const uint64_t mask = detail::nondigit_mask(detail::load8(text.data() + n))) {
+                return n + static_cast<size_t>(std::countr_zero(mask)) / 8;
+            }
+        }
+    }
+    while (n < text.size() && text[n] >= '0' && text[n] <= '9') n++;
+    return n;
+}
+
+// Number of characters equal to c at the start of text
+inline size_t skip_run(std::string_view text, char c) {
+    size_t n{0};
+#if defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; n + 16 <= text.size(); n += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + n));
+        const unsigned other = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle))) & 0xFFFF;
+        if (other != 0) return n + static_cast<size_t>(std::countr_zero(other));
+    }
+#endif
+    while (n < text.size() && text[n] == c) n++;
+    return n;
+}
+
+namespace detail {
+
+// the hot loops report failures as codes, messages are only built once something failed
+enum class Errc { none, no_digits, out_of_range };
+
+inline std::string_view message(Errc errc) {
+    return errc == Errc::no_digits ? "expected a number" : "number out of range";
+}
+
+// digit runs of eight or more, or too close to the end of the buffer for a full load
+inline Errc parse_long_unsigned(const char*& p, const char* end, uint64_t& out) {
+    size_t length = digit_run({p, static_cast<size_t>(end - p)});
+    if (length == 0) return Errc::no_digits;
+    const char* stop = p + length;
+    const char* q = p;
+
+    // leading zeros never overflow; a 20th significant digit only fits as the leading 1 of
+    // a large uint64_t, so it is split off and the other 19 never overflow
+    while (length > 1 && *q == '0') {
+        q++;
+        length--;
+    }
+    if (length > 20) return Errc::out_of_range;
+    uint64_t lead{0};
+    if (length == 20) {
+        lead = static_cast<uint64_t>(*q++ - '0');
+        length--;
+    }
+
+    uint64_t value{0};
+    while (length > 0) {
+        // the first block takes the odd digits so all later ones are full
+        const size_t take = (length % 8 == 0) ? 8 : length % 8;
+        uint64_t scale{1};
+        for (size_t i = 0; i < take; i++) scale *= 10;
+        value = value * scale + parse_block(q, take, end - q >= 8);
+        q += take;
+        length -= take;
+    }
+
+    if (lead != 0) {
+        constexpr uint64_t e19{10'000'000'000'000'000'000u};
+        if (lead > 1 || value > std::numeric_limits<uint64_t>::max() - e19) return Errc::out_of_range;
+        value += e19;
+    }
+    p = stop;
+    out = value;
+    return Errc::none;
+}
+
+// numbers of up to 15 digits take one or two loads and parse8 calls
+inline Errc parse_unsigned(const char*& p, const char* end, uint64_t& out) {
+    constexpr uint64_t zeros{0x3030303030303030};
+    if constexpr (swar) {
+        const size_t available = static_cast<size_t>(end - p);
+        const uint64_t high = load_upto8(p, available);
+        if (const uint64_t mask = nondigit_mask(high)) {
+            const size_t length = static_cast<size_t>(std::countr_zero(mask)) / 8;
+            if (length == 0) return Errc::no_digits;
+            out = parse8((high - zeros) << (8 * (8 - length)));
+            p += length;
+            return Errc::none;
+        }
+        const uint64_t low = load_upto8(p + 8, available - 8);
+        if (const uint64_t mask = nondigit_mask(low)) {
+            constexpr std::array<uint64_t, 8> scale{1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+            const size_t length = static_cast<size_t>(std::countr_zero(mask)) / 8;
+            out = parse8(high - zeros) * scale[length];
+            if (length > 0) out += parse8((low - zeros) << (8 * (8 - length)));
+            p += 8 + length;
+            return Errc::none;
+        }
+    }
+    return parse_long_unsigned(p, end, out);
+}
+
+// integer at p with a leading '-' for signed T; p only advances on success
+template <std::integral T>
+Errc parse_integer(const char*& p, const char* end, T& out) {
+    const char* q = p;
+    bool negative{false};
+    if constexpr (std::is_signed_v<T>) {
+        if (q < end && *q == '-') {
+            negative = true;
+            q++;
+        }
+    }
+
+    uint64_t value;
+    if (const Errc errc = parse_unsigned(q, end, value); errc != Errc::none) return errc;
+    const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+    if (value > limit) return Errc::out_of_range;
+
+    using U = std::make_unsigned_t<T>;
+    out = negative ? static_cast<T>(U{0} - static_cast<U>(value)) : static_cast<T>(value);
+    p = q;
+    return Errc::none;
+}
+
+// past the spaces at p. Column padding is short, and a predicted byte loop beats any
+// vector setup there, so only runs past eight spaces go to the vector scan
+inline const char* skip_spaces(const char* p, const char* end) {
+    const char* stop = std::min(end, p + 8);
+    while (p < stop && *p == ' ') p++;
+    if (p == stop && p < end) p += skip_run({p, static_cast<size_t>(end - p)}, ' ');
+    return p;
+}
+
+} // namespace detail
+
+// Parses the integer at the start of text, with a leading '-' for signed T, and advances
+// text past it
+template <std::integral T>
+std::expected<T, std::string> parse_int(std::string_view& text) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    T value;
+    if (const auto errc = detail::parse_integer(p, end, value); errc != detail::Errc::none) {
+        return std::unexpected(std::string{detail::message(errc)});
+    }
+    text.remove_prefix(static_cast<size_t>(p - text.data()));
+    return value;
+}
+
+// Parses text that is exactly one integer
+template <std::integral T>
+std::expected<T, std::string> parse_number(std::string_view text) {
+    auto value = parse_int<T>(text);
+    if (value && !text.empty()) {
+        return std::unexpected("unexpected characters after number");
+    }
+    return value;
+}
+
+// Parses integers separated by sep (any run of spaces when sep is ' ') and hands each one
+// to sink, which returns false when it cannot take more. Returns how many were parsed.
+template <std::integral T, typename Sink>
+std::expected<size_t, std::string> parse_list_with(std::string_view text, char sep, Sink&& sink) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    // takes the position instead of capturing the cursor, which keeps it in a register
+    auto fail = [&text](const char* at, std::string_view what) {
+        return std::unexpected(std::format("{} at column {}", what, at - text.data() + 1));
+    };
+
+    size_t count{0};
+    if (sep == ' ') p = detail::skip_spaces(p, end);
+    while (p < end) {
+        T value;
+        if (const auto errc = detail::parse_integer(p, end, value); errc != detail::Errc::none) {
+            return fail(p, detail::message(errc));
+        }
+        if (!sink(value)) return fail(p, std::format("more than {} numbers", count));
+        count++;
+
+        if (p == end) break;
+        if (*p != sep) return fail(p, std::format("expected '{}'", sep));
+        if (sep == ' ') {
+            p = detail::skip_spaces(p, end);
+        } else if (++p == end) {
+            return fail(p, "expected a number");
+        }
+    }
+    return count;
+}
+
+// Parses a separated list into out, failing when out is too small
+template <std::integral T, size_t N>
+std::expected<size_t, std::string> parse_list(std::string_view text, char sep, std::span<T, N> out) {
+    size_t n{0};
+    return parse_list_with<T>(text, sep, [&](T value) {
+        if (n == out.size()) return false;
+        out[n++] = value;
+        return true;
+    });
+}
+
+// Parses a separated list and appends it to out
+template <std::integral T, typename Alloc>
+std::expected<size_t, std::string> parse_list(std::string_view text, char sep, std::vector<T, Alloc>& out) {
+    return parse_list_with<T>(text, sep, [&](T value) {
+        out.push_back(value);
+        return true;
+    });
+}
+
+// Parses exactly out.size() separated integers, e.g. the "x,y,z" of a coordinate
+template <std::integral T, size_t N>
+std::expected<void, std::string> parse_fixed(std::string_view text, char sep, std::span<T, N> out) {
+    auto count = parse_list(text, sep, out);
+    if (!count) return std::unexpected(count.error());
+    if (*count != out.size()) {
+        return std::unexpected(std::format("expected {} numbers, found {}", out.size(), *count));
+    }
+    return {};
+}
+
+} // namespace aoc
@@ -0,0 +1,429 @@
+// Scoped phase probes: wall time and, on Linux, hardware counters per named phase.
+//
+// AOC_PHASE("day08/sort") opens a phase that ends with the enclosing scope, AOC_PHASE_NEXT
+// ends it early and opens the next one in the same scope. Phases nest and each one reports
+// inclusive totals over all its calls and threads, in the order they first ran.
+//
+// The probes only exist in builds with -DAOC_PROBE. Otherwise both macros expand to nothing,
+// so they can stay in the solutions at no cost. A probe build prints its report to stderr at
+// exit, as a table or as JSON when the environment sets AOC_PROBE=json. Every phase costs
+// two counter reads, so phases belong around work of a few microseconds or more.
+//
+// The counters (cycles, instructions, cache misses, branch misses, user space only) come from
+// one perf_event_open group per thread. Where the kernel refuses them, as in most containers
+// or with perf_event_paranoid above 2, the report keeps the times and leaves the counters out.
+//
+// -DAOC_PROBE_ALLOC (which implies AOC_PROBE) also counts heap traffic per phase: allocations,
+// bytes allocated and the peak of live bytes above the level the phase started at. The global
+// operator new/delete hooks doing the counting are in alloc_hooks.hpp, which the file with
+// main() includes; pmr containers can count through memory_resource() instead. Allocations
+// are charged to the thread making them, so work handed to a pool shows up in the phases the
+// workers run, not in the phase that waits for them.
+//
+// Every thread sums its own phases and hands them to the report when it exits, so a phase
+// stop never takes a lock; threads still running when the program ends are left out.
+
+#pragma once
+
+#include <memory_resource>
+
+#if defined(AOC_PROBE_ALLOC) && !defined(AOC_PROBE)
+#define AOC_PROBE
+#endif
+
+#if defined(AOC_PROBE)
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <new>
+#include <mutex>
+#include <print>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace aoc::probe {
+
+inline constexpr std::array<std::string_view, 4> counter_names{"cycles", "instructions", "cache_misses", "branch_misses"};
+using Counts = std::array<uint64_t, counter_names.size()>;
+
+namespace detail {
+
+// The counter group of the calling thread, opened on first use and enabled for the lifetime
+// of the thread. read() gives the counts since then, scaled up if the kernel multiplexed them.
+class Counters {
+public:
+    Counters() {
+#if defined(__linux__)
+        constexpr std::array<uint64_t, counter_names.size()> configs{
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES};
+        for (size_t i = 0; i < configs.size(); ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[i];
+            attr.disabled = i == 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds_[0], 0);
+            if (fd < 0) {
+                close_all();
+                return;
+            }
+            fds_[i] = static_cast<int>(fd);
+        }
+        if (ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) close_all();
+#endif
+    }
+    ~Counters() { close_all(); }
+    Counters(const Counters&) = delete;
+    Counters& operator=(const Counters&) = delete;
+
+    bool available() const { return fds_[0] >= 0; }
+
+    Counts read() const {
+        Counts counts{};
+#if defined(__linux__)
+        // nr, time enabled, time running, then one value per counter
+        std::array<uint64_t, 3 + counter_names.size()> buffer{};
+        if (!available() || ::read(fds_[0], buffer.data(), sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer))) {
+            return counts;
+        }
+        const uint64_t enabled = buffer[1];
+        const uint64_t running = buffer[2];
+        for (size_t i = 0; i < counts.size(); ++i) {
+            const uint64_t value = buffer[3 + i];
+            counts[i] = (running == 0 || running == enabled)
+                      ? value
+                      : static_cast<uint64_t>(static_cast<unsigned __int128>(value) * enabled / running);
+        }
+#endif
+        return counts;
+    }
+
+private:
+    void close_all() {
+#if defined(__linux__)
+        for (int& fd : fds_) {
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+        }
+#endif
+    }
+
+    std::array<int, counter_names.size()> fds_{-1, -1, -1, -1};
+};
+
+inline Counters& thread_counters() {
+    thread_local Counters counters;
+    return counters;
+}
+
+// Heap traffic of one thread. Plain data without constructors, so the allocation hooks can
+// use it at any point of the program's life.
+struct Heap {
+    uint64_t allocations;
+    uint64_t bytes;
+    int64_t live;  // allocated minus freed by this thread, negative when it frees others' memory
+    int64_t* peak; // high-water mark of the innermost open phase, if any
+};
+inline thread_local constinit Heap heap{};
+// Set on the first tracked allocation of any thread, shows the heap columns. Checked before the
+// store so allocating threads do not keep writing to the shared cache line.
+inline constinit std::atomic<bool> heap_tracked{false};
+
+inline void note_allocation(size_t size) {
+    heap.allocations++;
+    heap.bytes += size;
+    heap.live += static_cast<int64_t>(size);
+    if (heap.peak != nullptr && heap.live > *heap.peak) *heap.peak = heap.live;
+}
+
+inline void note_deallocation(size_t size) { heap.live -= static_cast<int64_t>(size); }
+
+// Heap blocks carry their size and the offset of the underlying malloc block in front of
+// them, so unsized and sized deallocations both know what they free.
+struct BlockHeader {
+    size_t size;
+    size_t offset;
+};
+inline constexpr size_t header_space = 2 * sizeof(size_t) > alignof(std::max_align_t)
+                                     ? 2 * sizeof(size_t) : alignof(std::max_align_t);
+
+inline void* tracked_allocate(size_t size, size_t align) {
+    const size_t offset = align > header_space ? align : header_space;
+    void* base = align > alignof(std::max_align_t)
+               ? std::aligned_alloc(align, (offset + size + align - 1) / align * align)
+               : std::malloc(offset + size);
+    if (base == nullptr) return nullptr;
+    if (!heap_tracked.load(std::memory_order_relaxed)) heap_tracked.store(true, std::memory_order_relaxed);
+    auto* user = static_cast<std::byte*>(base) + offset;
+    *reinterpret_cast<BlockHeader*>(user - sizeof(BlockHeader)) = {size, offset};
+    note_allocation(size);
+    return user;
+}
+
+inline void tracked_deallocate(void* p) {
+    if (p == nullptr) return;
+    auto* user = static_cast<std::byte*>(p);
+    const BlockHeader header = *reinterpret_cast<const BlockHeader*>(user - sizeof(BlockHeader));
+    note_deallocation(header.size);
+    std::free(user - header.offset);
+}
+
+// Upstream for pmr containers and arenas that counts like the global hooks but does not go
+// through them, so nothing is counted twice.
+class TrackedResource : public std::pmr::memory_resource {
+    void* do_allocate(size_t bytes, size_t align) override {
+        void* p = tracked_allocate(bytes, align);
+        if (p == nullptr) throw std::bad_alloc{};
+        return p;
+    }
+    void do_deallocate(void* p, size_t, size_t) override { tracked_deallocate(p); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+struct Sample {
+    std::chrono::steady_clock::time_point begin{};
+    uint64_t ns{0};
+    Counts counts{};
+    bool counted{false};
+    uint64_t allocations{0};
+    uint64_t bytes{0};
+    int64_t peak{0}; // live bytes above the level at the start of the phase
+};
+
+struct Totals {
+    std::chrono::steady_clock::time_point first{std::chrono::steady_clock::time_point::max()}; // earliest start
+    uint64_t calls{0};
+    uint64_t ns{0};
+    Counts counts{};
+    bool counted{true}; // every call had counters
+    uint64_t allocations{0};
+    uint64_t bytes{0};
+    int64_t peak{0};    // largest of all calls
+
+    void add(const Sample& sample) {
+        first = std::min(first, sample.begin);
+        calls++;
+        ns += sample.ns;
+        for (size_t i = 0; i < sample.counts.size(); ++i) counts[i] += sample.counts[i];
+        counted = counted && sample.counted;
+        allocations += sample.allocations;
+        bytes += sample.bytes;
+        peak = std::max(peak, sample.peak);
+    }
+
+    void merge(const Totals& other) {
+        first = std::min(first, other.first);
+        calls += other.calls;
+        ns += other.ns;
+        for (size_t i = 0; i < other.counts.size(); ++i) counts[i] += other.counts[i];
+        counted = counted && other.counted;
+        allocations += other.allocations;
+        bytes += other.bytes;
+        peak = std::max(peak, other.peak);
+    }
+};
+
+using PhaseTotals = std::vector<std::pair<std::string_view, Totals>>;
+
+inline Totals& find_or_add(PhaseTotals& phases, std::string_view name) {
+    auto it = std::ranges::find(phases, name, &PhaseTotals::value_type::first);
+    if (it == phases.end()) it = phases.insert(it, {name, Totals{}});
+    return it->second;
+}
+
+// Phase totals of the whole process. Destroyed at exit, after the thread-local counter groups
+// of the main thread, which is when it prints the report.
+class Registry {
+public:
+    Registry() = default;
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    void merge(const PhaseTotals& phases) {
+        std::scoped_lock guard{lock_};
+        for (const auto& [name, totals] : phases) find_or_add(phases_, name).merge(totals);
+    }
+
+    ~Registry() {
+        if (phases_.empty()) return;
+        // threads hand their totals over as they exit, the report goes by when phases first ran
+        std::ranges::stable_sort(phases_, {}, [](const auto& phase) { return phase.second.first; });
+        const char* format = std::getenv("AOC_PROBE");
+        if (format != nullptr && std::string_view{format} == "json") {
+            print_json();
+        } else {
+            print_table();
+        }
+    }
+
+private:
+    void print_table() const {
+        const bool heap_columns = heap_tracked.load(std::memory_order_relaxed);
+        std::string heap_header{};
+        if (heap_columns) heap_header = std::format(" {:>12} {:>14} {:>14}", "allocs", "alloc bytes", "peak bytes");
+        std::println(stderr, "{:<28} {:>9} {:>12} {:>14} {:>14} {:>6} {:>12} {:>12}{}", "phase", "calls",
+                     "total ms", "cycles", "instructions", "IPC", "cache miss", "branch miss", heap_header);
+        for (const auto& [name, t] : phases_) {
+            std::string counters = std::format("{:>14} {:>14} {:>6} {:>12} {:>12}", "-", "-", "-", "-", "-");
+            if (t.counted) {
+                const double ipc = t.counts[0] == 0 ? 0.0 : static_cast<double>(t.counts[1]) / static_cast<double>(t.counts[0]);
+                counters = std::format("{:>14} {:>14} {:>6.2f} {:>12} {:>12}", t.counts[0], t.counts[1], ipc,
+                                       t.counts[2], t.counts[3]);
+            }
+            if (heap_columns) counters += std::format(" {:>12} {:>14} {:>14}", t.allocations, t.bytes, t.peak);
+            std::println(stderr, "{:<28} {:>9} {:>12.3f} {}", name, t.calls, static_cast<double>(t.ns) / 1e6, counters);
+        }
+    }
+
+    void print_json() const {
+        const bool heap_columns = heap_tracked.load(std::memory_order_relaxed);
+        std::string out{R"({"phases":[)"};
+        for (size_t p = 0; p < phases_.size(); ++p) {
+            const auto& [name, t] = phases_[p];
+            out += std::format(R"({}{{"name":"{}","calls":{},"ns":{})", p > 0 ? "," : "", name, t.calls, t.ns);
+            for (size_t i = 0; i < counter_names.size(); ++i) {
+                out += t.counted ? std::format(R"(,"{}":{})", counter_names[i], t.counts[i])
+                                 : std::format(R"(,"{}":null)", counter_names[i]);
+            }
+            if (heap_columns) {
+                out += std::format(R"(,"allocations":{},"allocated_bytes":{},"peak_live_bytes":{})",
+                                   t.allocations, t.bytes, t.peak);
+            }
+            out += '}';
+        }
+        std::println(stderr, "{}]}}", out);
+    }
+
+    std::mutex lock_;
+    PhaseTotals phases_;
+};
+
+inline Registry registry;
+
+// Phase totals of one thread, merged into the registry when the thread exits. Phases that
+// run on many workers at once, like a solve per task, then never wait for each other; the
+// main thread's totals are merged before the registry reports, which is destroyed later.
+class ThreadTotals {
+public:
+    ThreadTotals() = default;
+    ThreadTotals(const ThreadTotals&) = delete;
+    ThreadTotals& operator=(const ThreadTotals&) = delete;
+    ~ThreadTotals() { registry.merge(phases_); }
+
+    void add(std::string_view name, const Sample& sample) { find_or_add(phases_, name).add(sample); }
+
+private:
+    PhaseTotals phases_;
+};
+
+inline ThreadTotals& thread_totals() {
+    thread_local ThreadTotals totals;
+    return totals;
+}
+
+} // namespace detail
+
+// One timed section, see AOC_PHASE. The name must outlive the process, a string literal.
+class Phase {
+public:
+    explicit Phase(std::string_view name) : name_{name} { start(); }
+    ~Phase() { stop(); }
+    Phase(const Phase&) = delete;
+    Phase& operator=(const Phase&) = delete;
+
+    void next(std::string_view name) {
+        stop();
+        name_ = name;
+        start();
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    void start() {
+        auto& heap = detail::heap;
+        heap_ = heap;
+        peak_ = heap.live;
+        parent_peak_ = heap.peak;
+        heap.peak = &peak_;
+        counts_ = detail::thread_counters().read();
+        begin_ = clock::now();
+    }
+
+    void stop() {
+        const auto end = clock::now();
+        const auto& counters = detail::thread_counters();
+        detail::Sample sample{};
+        sample.counts = counters.read();
+        for (size_t i = 0; i < sample.counts.size(); ++i) sample.counts[i] -= counts_[i];
+        sample.counted = counters.available();
+        sample.begin = begin_;
+        sample.ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin_).count());
+
+        // the enclosing phase saw everything this one did
+        auto& heap = detail::heap;
+        sample.allocations = heap.allocations - heap_.allocations;
+        sample.bytes = heap.bytes - heap_.bytes;
+        sample.peak = peak_ - heap_.live;
+        heap.peak = parent_peak_;
+        if (parent_peak_ != nullptr && peak_ > *parent_peak_) *parent_peak_ = peak_;
+
+        detail::thread_totals().add(name_, sample);
+    }
+
+    std::string_view name_;
+    Counts counts_{};
+    clock::time_point begin_{};
+    detail::Heap heap_{}; // at the start
+    int64_t peak_{0};
+    int64_t* parent_peak_{nullptr};
+};
+
+// Upstream for pmr arenas and containers: counted in probe builds with AOC_PROBE_ALLOC,
+// the plain new/delete resource otherwise.
+inline std::pmr::memory_resource* memory_resource() {
+#if defined(AOC_PROBE_ALLOC)
+    static detail::TrackedResource tracked;
+    return &tracked;
+#else
+    return std::pmr::new_delete_resource();
+#endif
+}
+
+} // namespace aoc::probe
+
+#define AOC_PHASE(name) ::aoc::probe::Phase aoc_phase_{name}
+#define AOC_PHASE_NEXT(name) aoc_phase_.next(name)
+
+#else
+
+namespace aoc::probe {
+
+inline std::pmr::memory_resource* memory_resource() { return std::pmr::new_delete_resource(); }
+
+} // namespace aoc::probe
+
+#define AOC_PHASE(name) static_cast<void>(0)
+#define AOC_PHASE_NEXT(name) static_cast<void>(0)
+
+#endif
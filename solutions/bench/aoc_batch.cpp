@@ -0,0 +1,215 @@
+// Batch runner: solves many inputs of one day on a fixed pool of worker threads.
+//
+// Usage: aoc_batch <day> <input>... [--threads=N] [--json]
+//   input      a file, a directory (its regular files, by name) or @list, a file naming one
+//              input per line
+//   --threads  workers (default: all cores)
+//   --json     one JSON object per line for every input as it finishes, then a summary line
+//
+// Every worker reads its inputs into a buffer it keeps, so reading only allocates for an input
+// larger than all the worker has seen. Results are printed as the inputs finish, followed by
+// the throughput in files/s and MB/s; the exit code is nonzero if any input failed. Day 10
+// already solves part 2 of a single input on all cores, so it scales best with --threads=1.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <expected>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <mutex>
+#include <print>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../aoc/alloc_hooks.hpp"
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../days/registry.hpp"
+
+namespace {
+
+struct Result {
+    int64_t part1{0};
+    int64_t part2{0};
+    int64_t parse_ns{0};
+    int64_t solve_ns{0};
+    std::string error{};
+};
+
+using Solver = std::function<Result(std::string_view)>;
+
+template <typename Parse, typename Part1, typename Part2>
+Solver solver(Parse parse, Part1 part1, Part2 part2) {
+    return [=](std::string_view text) {
+        using clock = std::chrono::steady_clock;
+        auto ns = [](clock::time_point a, clock::time_point b) {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count();
+        };
+        Result result;
+        const auto t0 = clock::now();
+        auto input = parse(text);
+        const auto t1 = clock::now();
+        result.parse_ns = ns(t0, t1);
+        if (!input) {
+            result.error = input.error();
+            return result;
+        }
+        result.part1 = part1(*input);
+        result.part2 = part2(*input);
+        result.solve_ns = ns(t1, clock::now());
+        return result;
+    };
+}
+
+// Expands the input arguments into the list of files to solve
+std::expected<std::vector<std::filesystem::path>, std::string> collect(const std::vector<std::string_view>& args) {
+    std::vector<std::filesystem::path> files;
+    for (std::string_view arg : args) {
+        if (arg.starts_with('@')) {
+            auto list = aoc::Input::open(arg.substr(1));
+            if (!list) return std::unexpected(list.error());
+            for (std::string_view line : list->lines()) {
+                if (!line.empty()) files.emplace_back(line);
+            }
+            continue;
+        }
+
+        const std::filesystem::path path{arg};
+        std::error_code ec;
+        if (!std::filesystem::is_directory(path, ec)) {
+            files.push_back(path);
+            continue;
+        }
+        std::vector<std::filesystem::path> entries;
+        for (const auto& entry : std::filesystem::directory_iterator{path, ec}) {
+            if (entry.is_regular_file()) entries.push_back(entry.path());
+        }
+        if (ec) return std::unexpected(std::format("Failed to list {}: {}", path.string(), ec.message()));
+        std::ranges::sort(entries);
+        files.insert(files.end(), entries.begin(), entries.end());
+    }
+    return files;
+}
+
+std::string json_string(std::string_view s) {
+    std::string out{"\""};
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) {
+            out += std::format("\\u{:04x}", static_cast<unsigned char>(c));
+            continue;
+        }
+        out += c;
+    }
+    return out + '"';
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::println(stderr, "Usage: {} <day> <file|directory|@list>... [--threads=N] [--json]", argv[0]);
+        return EXIT_FAILURE;
+    }
+    std::string day_name{argv[1]};
+    if (day_name.size() == 1) day_name.insert(day_name.begin(), '0');
+    Solver solve;
+    if (!days::with_day(day_name, [&](auto parse, auto part1, auto part2) { solve = solver(parse, part1, part2); })) {
+        std::println(stderr, "Unknown day: {} (expected 01 to 10)", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    bool json{false};
+    std::vector<std::string_view> inputs;
+    for (int i = 2; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (arg.starts_with("--threads=")) {
+            auto count = aoc::parse_number<unsigned>(arg.substr(10));
+            if (!count || *count == 0) {
+                std::println(stderr, "Invalid thread count: {}", arg);
+                return EXIT_FAILURE;
+            }
+            threads = *count;
+        } else if (arg == "--json") {
+            json = true;
+        } else if (arg.starts_with("--")) {
+            std::println(stderr, "Unknown option: {}", arg);
+            return EXIT_FAILURE;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    auto files = collect(inputs);
+    if (!files) {
+        std::println(stderr, "{}", files.error());
+        return EXIT_FAILURE;
+    }
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(files->size(), 1)));
+
+    // guarded by lock: the output and the totals
+    std::mutex lock;
+    size_t failed{0};
+    uint64_t bytes{0};
+
+    auto report = [&](const std::filesystem::path& path, size_t size, const Result& result) {
+        std::scoped_lock guard{lock};
+        bytes += size;
+        if (!result.error.empty()) failed++;
+        if (json) {
+            if (!result.error.empty()) {
+                std::println(R"({{"file":{},"error":{}}})", json_string(path.string()), json_string(result.error));
+            } else {
+                std::println(R"({{"file":{},"bytes":{},"part1":{},"part2":{},"parse_ns":{},"solve_ns":{}}})",
+                             json_string(path.string()), size, result.part1, result.part2, result.parse_ns,
+                             result.solve_ns);
+            }
+        } else if (!result.error.empty()) {
+            std::println("{}: {}", path.string(), result.error);
+        } else {
+            std::println("{}: part 1 {}, part 2 {} ({} bytes, parse {:.3f} ms, solve {:.3f} ms)", path.string(),
+                         result.part1, result.part2, size, result.parse_ns / 1e6, result.solve_ns / 1e6);
+        }
+    };
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    std::atomic<size_t> next{0};
+    {
+        std::vector<std::jthread> pool;
+        for (unsigned w = 0; w < threads; ++w) {
+            pool.emplace_back([&] {
+                std::string buffer;
+                for (size_t i = next++; i < files->size(); i = next++) {
+                    const auto& path = (*files)[i];
+                    auto text = aoc::read_file(path, buffer);
+                    if (!text) {
+                        report(path, 0, Result{.error = text.error()});
+                        continue;
+                    }
+                    report(path, text->size(), solve(*text));
+                }
+            });
+        }
+    }
+    const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    const double files_per_s = static_cast<double>(files->size()) / seconds;
+    const double mb_per_s = static_cast<double>(bytes) / 1e6 / seconds;
+    if (json) {
+        std::println(R"({{"summary":{{"day":"{}","files":{},"failed":{},"bytes":{},"threads":{},"seconds":{:.6f},"files_per_s":{:.1f},"mb_per_s":{:.2f}}}}})",
+                     day_name, files->size(), failed, bytes, threads, seconds, files_per_s, mb_per_s);
+    } else {
+        std::println("Day {}: {} files ({} failed), {:.2f} MB in {:.3f} s on {} threads: {:.1f} files/s, {:.2f} MB/s",
+                     day_name, files->size(), failed, static_cast<double>(bytes) / 1e6, seconds, threads,
+                     files_per_s, mb_per_s);
+    }
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,407 @@
+// Statistical benchmark of the day libraries: parse, part 1 and part 2 timed separately.
+//
+// Usage: aoc_bench <day> [input] [--warmup=N] [--reps=N] [--json]
+//        aoc_bench <day> --scale=FROM:TO[:FACTOR] [--seed=N] [--variant=NAME] [--warmup=N] [--reps=N] [--json]
+//   day      01 to 10 (or 1 to 10)
+//   input    puzzle file, ../inputs/input_NN.txt by default, "-" for stdin
+//   --warmup runs that are not recorded (default 2)
+//   --reps   recorded runs (default 10)
+//   --json   one JSON object on stdout instead of the table, for comparing builds:
+//            {"day":"07","input":"...","warmup":2,"reps":10,"answers":[1681,422102272495018],
+//             "phases":{"parse":{"min_ns":...,"median_ns":...,"p99_ns":...},"part1":{...},"part2":{...}}}
+//   --scale  runs the day over generated inputs (see generate.hpp) of sizes FROM, FROM * FACTOR, ...
+//            up to TO, FACTOR 2 by default, each in its own process. Reports the medians, the peak
+//            resident set and how both grow between sizes as the exponent k of n^k.
+//   --seed   generator seed for --scale (default 2025)
+//   --variant generator variant for --scale, e.g. "hard" for Day 10 manuals that grow instead of
+//            multiplying (see generate.hpp)
+//
+// The input is read once; every run parses the text again and solves the fresh result, so the
+// parse phase includes all allocations of the parsed form. Every run has to produce the same
+// answers, otherwise the benchmark fails.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <expected>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../aoc/alloc_hooks.hpp"
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../days/registry.hpp"
+#include "generate.hpp"
+
+namespace {
+
+struct Options {
+    int warmup{2};
+    int reps{10};
+};
+
+struct Stats {
+    int64_t min_ns{0};
+    int64_t median_ns{0};
+    int64_t p99_ns{0};
+};
+
+// nearest-rank percentiles over the recorded runs
+Stats summarize(std::vector<int64_t> samples) {
+    std::ranges::sort(samples);
+    const size_t n = samples.size();
+    const size_t p99 = (99 * n + 99) / 100; // ceil(0.99 * n), 1-based
+    return {samples.front(), samples[(n - 1) / 2], samples[std::max<size_t>(p99, 1) - 1]};
+}
+
+struct Report {
+    int64_t part1{0};
+    int64_t part2{0};
+    Stats parse, solve1, solve2;
+};
+
+template <typename Parse, typename Part1, typename Part2>
+std::expected<Report, std::string> measure(const Options& options, std::string_view text,
+                                           Parse parse, Part1 part1, Part2 part2) {
+    using clock = std::chrono::steady_clock;
+    auto ns = [](clock::time_point a, clock::time_point b) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count();
+    };
+
+    Report report;
+    std::vector<int64_t> parse_ns, part1_ns, part2_ns;
+    for (int run = 0; run < options.warmup + options.reps; ++run) {
+        const auto t0 = clock::now();
+        auto input = parse(text);
+        const auto t1 = clock::now();
+        if (!input) return std::unexpected(input.error());
+        const int64_t answer1 = part1(*input);
+        const auto t2 = clock::now();
+        const int64_t answer2 = part2(*input);
+        const auto t3 = clock::now();
+
+        if (run == 0) {
+            report.part1 = answer1;
+            report.part2 = answer2;
+        } else if (answer1 != report.part1 || answer2 != report.part2) {
+            return std::unexpected(std::format("run {} answered {} / {} instead of {} / {}",
+                                               run + 1, answer1, answer2, report.part1, report.part2));
+        }
+        if (run < options.warmup) continue;
+        parse_ns.push_back(ns(t0, t1));
+        part1_ns.push_back(ns(t1, t2));
+        part2_ns.push_back(ns(t2, t3));
+    }
+    report.parse = summarize(std::move(parse_ns));
+    report.solve1 = summarize(std::move(part1_ns));
+    report.solve2 = summarize(std::move(part2_ns));
+    return report;
+}
+
+using Runner = std::function<std::expected<Report, std::string>(const Options&, std::string_view)>;
+
+template <typename Parse, typename Part1, typename Part2>
+Runner runner(Parse parse, Part1 part1, Part2 part2) {
+    return [=](const Options& options, std::string_view text) {
+        return measure(options, text, parse, part1, part2);
+    };
+}
+
+struct Day {
+    std::string_view name;
+    Runner run;
+};
+
+const std::vector<Day>& registry() {
+    static const std::vector<Day> all = [] {
+        std::vector<Day> out;
+        for (std::string_view name : days::names) {
+            days::with_day(name, [&](auto parse, auto part1, auto part2) {
+                out.push_back({name, runner(parse, part1, part2)});
+            });
+        }
+        return out;
+    }();
+    return all;
+}
+
+std::string json_string(std::string_view s) {
+    std::string out{"\""};
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) {
+            out += std::format("\\u{:04x}", static_cast<unsigned char>(c));
+            continue;
+        }
+        out += c;
+    }
+    return out + '"';
+}
+
+std::string json_stats(const Stats& s) {
+    return std::format(R"({{"min_ns":{},"median_ns":{},"p99_ns":{}}})", s.min_ns, s.median_ns, s.p99_ns);
+}
+
+// "answers":[...],"phases":{...} of one report
+std::string json_report(const Report& r) {
+    return std::format(R"("answers":[{},{}],"phases":{{"parse":{},"part1":{},"part2":{}}})", r.part1, r.part2,
+                       json_stats(r.parse), json_stats(r.solve1), json_stats(r.solve2));
+}
+
+// Scaling mode: sizes from, from * factor, ... up to to, generated with one seed
+struct Scaling {
+    size_t from{0};
+    size_t to{0};
+    size_t factor{2};
+    uint64_t seed{2025};
+    std::string_view variant{};
+};
+
+struct Point {
+    size_t n{0};
+    size_t bytes{0};
+    Report report{};
+    int64_t peak_rss{0}; // bytes, of the whole run
+};
+
+// what the child process sends back, plain bytes through a pipe
+struct Message {
+    bool ok{false};
+    Report report{};
+    char error[256]{};
+};
+
+// Runs one size in a child process, so every size starts from a fresh heap and the peak resident
+// set the kernel reports for the child is the cost of that size alone: the mapped input, the
+// parsed form and whatever the solvers allocate.
+std::expected<Point, std::string> run_isolated(const Day& day, const Options& options,
+                                               const std::filesystem::path& path, size_t n, size_t bytes) {
+    int fds[2];
+    if (pipe(fds) != 0) return std::unexpected("Failed to create a pipe");
+    const pid_t pid = fork();
+    if (pid < 0) return std::unexpected("Failed to start a child process");
+
+    if (pid == 0) {
+        close(fds[0]);
+        Message message;
+        auto input = aoc::Input::open(path);
+        auto report = input ? day.run(options, input->text()) : std::unexpected(input.error());
+        if (report) {
+            message.ok = true;
+            message.report = *report;
+        } else {
+            std::format_to_n(message.error, sizeof(message.error) - 1, "{}", report.error());
+        }
+        const bool sent = write(fds[1], &message, sizeof(message)) == static_cast<ssize_t>(sizeof(message));
+        _exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+    Message message;
+    size_t received{0};
+    while (received < sizeof(message)) {
+        const ssize_t got = read(fds[0], reinterpret_cast<char*>(&message) + received, sizeof(message) - received);
+        if (got <= 0) break;
+        received += static_cast<size_t>(got);
+    }
+    close(fds[0]);
+    int status{0};
+    rusage usage{};
+    wait4(pid, &status, 0, &usage);
+
+    if (received != sizeof(message)) return std::unexpected(std::format("n = {}: the run died", n));
+    if (!message.ok) return std::unexpected(std::format("n = {}: {}", n, message.error));
+    return Point{n, bytes, message.report, int64_t{usage.ru_maxrss} * 1024}; // ru_maxrss is in KiB
+}
+
+int run_scaling(const Day& day, const Options& options, const Scaling& scaling, bool json) {
+    const gen::Generator* generator = gen::find(day.name, scaling.variant);
+    if (generator == nullptr) {
+        std::println(stderr, "Day {} has no generator variant {}", day.name, scaling.variant);
+        return EXIT_FAILURE;
+    }
+    const auto path = std::filesystem::temp_directory_path() / std::format("aoc_bench_{}_{}.txt", day.name, getpid());
+
+    auto total = [](const Point& p) {
+        return static_cast<double>(p.report.parse.median_ns + p.report.solve1.median_ns + p.report.solve2.median_ns);
+    };
+    // growth between two sizes as the exponent k of n^k
+    auto exponent = [](double before, double after, size_t n0, size_t n1) {
+        return std::log(after / before) / std::log(static_cast<double>(n1) / static_cast<double>(n0));
+    };
+
+    if (!json) {
+        std::println("Day {}{}: seed {}, {} warmup + {} runs per size, medians", day.name,
+                     scaling.variant.empty() ? "" : std::format(" ({})", scaling.variant), scaling.seed,
+                     options.warmup, options.reps);
+        std::println("{:>12} {:>10} {:>12} {:>12} {:>12} {:>10} {:>7} {:>7}",
+                     "n", "input MiB", "parse ms", "part1 ms", "part2 ms", "peak MiB", "time ~", "mem ~");
+    }
+    std::vector<Point> points;
+    for (size_t n = scaling.from; n <= scaling.to; n *= scaling.factor) {
+        size_t bytes{0};
+        {
+            const std::string text = generator->make(n, scaling.seed);
+            bytes = text.size();
+            std::ofstream out{path, std::ios::binary};
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+            if (!out) {
+                std::println(stderr, "Failed to write {}", path.string());
+                std::filesystem::remove(path);
+                return EXIT_FAILURE;
+            }
+        }
+        auto point = run_isolated(day, options, path, n, bytes);
+        std::filesystem::remove(path);
+        if (!point) {
+            std::println(stderr, "Day {}: {}", day.name, point.error());
+            return EXIT_FAILURE;
+        }
+
+        if (!json) {
+            const Report& r = point->report;
+            std::string growth{};
+            if (!points.empty()) {
+                const Point& prev = points.back();
+                growth = std::format("{:>7.2f} {:>7.2f}", exponent(total(prev), total(*point), prev.n, n),
+                                     exponent(static_cast<double>(prev.peak_rss), static_cast<double>(point->peak_rss), prev.n, n));
+            }
+            std::println("{:>12} {:>10.1f} {:>12.3f} {:>12.3f} {:>12.3f} {:>10.1f} {}", n,
+                         static_cast<double>(bytes) / (1 << 20), r.parse.median_ns / 1e6, r.solve1.median_ns / 1e6,
+                         r.solve2.median_ns / 1e6, static_cast<double>(point->peak_rss) / (1 << 20), growth);
+        }
+        points.push_back(*point);
+        if (n > scaling.to / scaling.factor) break; // the next size would overflow
+    }
+
+    if (json) {
+        std::string out = std::format(R"({{"day":"{}","seed":{},"warmup":{},"reps":{},"scaling":[)",
+                                      day.name, scaling.seed, options.warmup, options.reps);
+        for (size_t i = 0; i < points.size(); ++i) {
+            const Point& p = points[i];
+            if (i > 0) out += ',';
+            out += std::format(R"({{"n":{},"bytes":{},"peak_rss_bytes":{},{}}})", p.n, p.bytes, p.peak_rss, json_report(p.report));
+        }
+        std::println("{}]}}", out);
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::println(stderr, "Usage: {} <day> [input] [--warmup=N] [--reps=N] [--json]", argv[0]);
+        std::println(stderr, "       {} <day> --scale=FROM:TO[:FACTOR] [--seed=N] [--variant=NAME] [--warmup=N] [--reps=N] [--json]", argv[0]);
+        return EXIT_FAILURE;
+    }
+    std::string day_name{argv[1]};
+    if (day_name.size() == 1) day_name.insert(day_name.begin(), '0');
+    auto day = std::ranges::find(registry(), std::string_view{day_name}, &Day::name);
+    if (day == registry().end()) {
+        std::println(stderr, "Unknown day: {} (expected 01 to 10)", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    std::filesystem::path input_path{std::format("../inputs/input_{}.txt", day_name)};
+    Options options;
+    std::optional<Scaling> scaling{};
+    uint64_t seed{2025};
+    std::string_view variant{};
+    bool json{false};
+    for (int i = 2; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (arg.starts_with("--warmup=")) {
+            auto warmup = aoc::parse_number<int>(arg.substr(9));
+            if (!warmup || *warmup < 0) {
+                std::println(stderr, "Invalid warmup count: {}", arg);
+                return EXIT_FAILURE;
+            }
+            options.warmup = *warmup;
+        } else if (arg.starts_with("--reps=")) {
+            auto reps = aoc::parse_number<int>(arg.substr(7));
+            if (!reps || *reps < 1) {
+                std::println(stderr, "Invalid repetition count: {}", arg);
+                return EXIT_FAILURE;
+            }
+            options.reps = *reps;
+        } else if (arg.starts_with("--scale=")) {
+            std::array<size_t, 3> range{0, 0, 2};
+            std::span<size_t> sizes{range};
+            auto count = aoc::parse_list(arg.substr(8), ':', sizes);
+            if (!count || *count < 2 || range[0] == 0 || range[0] > range[1] || range[2] < 2) {
+                std::println(stderr, "Invalid scale: {} (expected FROM:TO[:FACTOR] with 0 < FROM <= TO, FACTOR >= 2)", arg);
+                return EXIT_FAILURE;
+            }
+            scaling = Scaling{range[0], range[1], range[2]};
+        } else if (arg.starts_with("--seed=")) {
+            auto value = aoc::parse_number<uint64_t>(arg.substr(7));
+            if (!value) {
+                std::println(stderr, "Invalid seed: {}", arg);
+                return EXIT_FAILURE;
+            }
+            seed = *value;
+        } else if (arg.starts_with("--variant=")) {
+            variant = arg.substr(10);
+        } else if (arg == "--json") {
+            json = true;
+        } else if (i == 2 && !arg.starts_with("--")) {
+            input_path = arg;
+        } else {
+            std::println(stderr, "Unknown option: {}", arg);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (scaling) {
+        scaling->seed = seed;
+        scaling->variant = variant;
+        return run_scaling(*day, options, *scaling, json);
+    }
+
+    auto input = aoc::Input::open(input_path);
+    if (!input) {
+        std::println(stderr, "{}", input.error());
+        return EXIT_FAILURE;
+    }
+
+    auto report = day->run(options, input->text());
+    if (!report) {
+        std::println(stderr, "Day {}: {}", day_name, report.error());
+        return EXIT_FAILURE;
+    }
+
+    if (json) {
+        std::println(R"({{"day":"{}","input":{},"warmup":{},"reps":{},{}}})", day_name,
+                     json_string(input_path.string()), options.warmup, options.reps, json_report(*report));
+        return EXIT_SUCCESS;
+    }
+
+    const std::pair<std::string_view, const Stats&> phases[]{
+        {"parse", report->parse}, {"part1", report->solve1}, {"part2", report->solve2}};
+    std::println("Day {}: {} ({} bytes), {} warmup + {} runs", day_name, input_path.string(),
+                 input->text().size(), options.warmup, options.reps);
+    std::println("Part 1: {}", report->part1);
+    std::println("Part 2: {}", report->part2);
+    std::println("{:<6} {:>14} {:>14} {:>14}", "phase", "min ns", "median ns", "p99 ns");
+    for (const auto& [name, s] : phases) {
+        std::println("{:<6} {:>14} {:>14} {:>14}", name, s.min_ns, s.median_ns, s.p99_ns);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+// Writes a header that builds an input file into a binary, for compilers without #embed; see
+// aoc/embed.hpp.
+//
+// Usage: aoc_embed <input> > input_embed.hpp
+//   g++ -std=c++23 -O2 -DAOC_EMBED_HEADER='"input_embed.hpp"' 03.cpp -o 03_embedded
+//
+// Every input line becomes one string literal, so the header stays readable and no single
+// literal gets long. Quotes, backslashes and anything outside printable ASCII are escaped as
+// three-digit octal, which cannot run into the character after it.
+
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <iterator>
+#include <print>
+#include <string>
+
+#include "../aoc/input.hpp"
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::println(stderr, "Usage: {} <input>", argv[0]);
+        return EXIT_FAILURE;
+    }
+    auto input = aoc::Input::open(argv[1]);
+    if (!input) {
+        std::println(stderr, "{}", input.error());
+        return EXIT_FAILURE;
+    }
+    const std::string_view text = input->text();
+
+    std::string header;
+    header.reserve(text.size() + text.size() / 8 + 512);
+    auto out = std::back_inserter(header);
+    std::format_to(out, "// Generated by aoc_embed from {}, do not edit.\n\n", argv[1]);
+    header += "#pragma once\n\n#include <string_view>\n\nnamespace aoc {\n\n";
+    header += "inline constexpr char embedded_bytes[] =";
+    bool open{false};
+    for (char c : text) {
+        if (!open) {
+            header += "\n    \"";
+            open = true;
+        }
+        const auto byte = static_cast<unsigned char>(c);
+        if (c == '\n') {
+            header += "\\n\"";
+            open = false;
+        } else if (c == '"' || c == '\\' || byte < 0x20 || byte > 0x7E) {
+            std::format_to(out, "\\{:03o}", byte);
+        } else {
+            header += c;
+        }
+    }
+    if (open) header += '"';
+    if (text.empty()) header += " \"\"";
+    header += ";\n\n";
+    header += "inline constexpr std::string_view embedded_input{embedded_bytes, sizeof(embedded_bytes) - 1};\n\n";
+    header += "} // namespace aoc\n";
+
+    if (std::fwrite(header.data(), 1, header.size(), stdout) != header.size() || std::fflush(stdout) != 0) {
+        std::println(stderr, "Failed to write the header");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
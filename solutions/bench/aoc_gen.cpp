@@ -0,0 +1,67 @@
+// Writes a synthetic puzzle input of the given scale to stdout, see generate.hpp for what the
+// scale counts per day.
+//
+// Usage: aoc_gen <day> <n> [--seed=N] [--variant=NAME]
+//   aoc_gen 03 10000000 > banks.txt
+//   aoc_gen 04 50000 --seed=7 > grid.txt
+//   aoc_gen 10 40 --variant=hard > manuals.txt
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <print>
+#include <string>
+#include <string_view>
+
+#include "../aoc/parse.hpp"
+#include "generate.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::println(stderr, "Usage: {} <day> <n> [--seed=N] [--variant=NAME]", argv[0]);
+        return EXIT_FAILURE;
+    }
+    std::string day_name{argv[1]};
+    if (day_name.size() == 1) day_name.insert(day_name.begin(), '0');
+    if (gen::find(day_name) == nullptr) {
+        std::println(stderr, "Unknown day: {} (expected 01 to 10)", argv[1]);
+        return EXIT_FAILURE;
+    }
+    auto n = aoc::parse_number<size_t>(argv[2]);
+    if (!n) {
+        std::println(stderr, "Invalid scale: {}: {}", argv[2], n.error());
+        return EXIT_FAILURE;
+    }
+
+    uint64_t seed{2025};
+    std::string_view variant{};
+    for (int i = 3; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (arg.starts_with("--variant=")) {
+            variant = arg.substr(10);
+            continue;
+        }
+        if (!arg.starts_with("--seed=")) {
+            std::println(stderr, "Unknown option: {}", arg);
+            return EXIT_FAILURE;
+        }
+        auto value = aoc::parse_number<uint64_t>(arg.substr(7));
+        if (!value) {
+            std::println(stderr, "Invalid seed: {}: {}", arg, value.error());
+            return EXIT_FAILURE;
+        }
+        seed = *value;
+    }
+    const gen::Generator* generator = gen::find(day_name, variant);
+    if (generator == nullptr) {
+        std::println(stderr, "Day {} has no generator variant {}", day_name, variant);
+        return EXIT_FAILURE;
+    }
+
+    const std::string text = generator->make(*n, seed);
+    if (std::fwrite(text.data(), 1, text.size(), stdout) != text.size() || std::fflush(stdout) != 0) {
+        std::println(stderr, "Failed to write the input");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,332 @@
+// Seeded generators of valid puzzle inputs at any size, for load tests of the day libraries.
+//
+// Every generator takes a scale n and a seed and returns the whole input text; the same n and
+// seed always give the same text. What n counts depends on the day:
+//   01  rotations                             06  problems
+//   02  ID ranges                             07  grid side, splitters on every other row
+//   03  battery banks of 100 digits           08  junction boxes
+//   04  grid side                             09  red tiles (rounded down to a multiple of 8)
+//   05  fresh ranges, and as many ingredients  10  manuals
+// Variants scale something other than the puzzle shape:
+//   10 hard  the size of 16 manuals: counters, free buttons and joltages all grow with n
+//   10 large n manuals with joltages near 10^15, beyond what doubles count exactly
+// The shapes follow the puzzle inputs, so Days 06 and 07 overflow their int64_t answers long
+// before the inputs get large. Their timings stay meaningful, the answers do not.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace gen {
+
+namespace detail {
+
+// one draw of the engine fills eight cells
+template <typename Map>
+void fill(char* out, size_t count, std::mt19937_64& rng, Map map) {
+    for (size_t i = 0; i < count; i += 8) {
+        uint64_t bits = rng();
+        for (size_t k = i; k < std::min(i + 8, count); ++k, bits >>= 8) {
+            out[k] = map(static_cast<uint8_t>(bits));
+        }
+    }
+}
+
+// rows of width random cells, each followed by a newline
+template <typename Map>
+std::string grid(size_t width, size_t height, std::mt19937_64& rng, Map map) {
+    std::string text(height * (width + 1), '\n');
+    for (size_t y = 0; y < height; ++y) fill(text.data() + y * (width + 1), width, rng, map);
+    return text;
+}
+
+// count positive steps that add up to total (total >= count)
+inline std::vector<int64_t> steps(size_t count, int64_t total, std::mt19937_64& rng) {
+    std::uniform_int_distribution<int64_t> weight{1, 1000};
+    std::vector<int64_t> cumulative(count);
+    int64_t sum{0};
+    for (auto& c : cumulative) c = sum += weight(rng);
+
+    // position i lies at least i past the start, so no step is empty
+    std::vector<int64_t> out(count);
+    int64_t prev{0};
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t slack = total - static_cast<int64_t>(count);
+        const int64_t pos = static_cast<int64_t>(i + 1)
+                          + static_cast<int64_t>(static_cast<__int128>(cumulative[i]) * slack / sum);
+        out[i] = pos - prev;
+        prev = pos;
+    }
+    return out;
+}
+
+} // namespace detail
+
+// Turns of 1 to 999 clicks either way, so most pass 0 at least once
+inline std::string day01(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<int> clicks{1, 999};
+    std::string text;
+    text.reserve(n * 5);
+    auto out = std::back_inserter(text);
+    for (size_t i = 0; i < n; ++i) std::format_to(out, "{}{}\n", (rng() & 1) ? 'R' : 'L', clicks(rng));
+    return text;
+}
+
+// Ranges of up to ten billion IDs anywhere below 10^17, far wider than the puzzle's
+inline std::string day02(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<int64_t> id{1, 100'000'000'000'000'000};
+    std::uniform_int_distribution<int64_t> width{0, 10'000'000'000};
+    std::string text;
+    auto out = std::back_inserter(text);
+    for (size_t i = 0; i < n; ++i) {
+        const int64_t first = id(rng);
+        std::format_to(out, "{}{}-{}", i > 0 ? "," : "", first, first + width(rng));
+    }
+    text += '\n';
+    return text;
+}
+
+inline std::string day03(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    return detail::grid(100, n, rng, [](uint8_t b) { return static_cast<char>('1' + (b * 9 >> 8)); });
+}
+
+inline std::string day04(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    return detail::grid(n, n, rng, [](uint8_t b) { return b < 171 ? '@' : '.'; }); // 2/3 paper
+}
+
+inline std::string day05(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<int64_t> id{1, 100'000'000'000'000};
+    std::uniform_int_distribution<int64_t> length{0, 1'000'000'000'000};
+    std::string text;
+    auto out = std::back_inserter(text);
+    for (size_t i = 0; i < n; ++i) {
+        const int64_t first = id(rng);
+        std::format_to(out, "{}-{}\n", first, first + length(rng));
+    }
+    text += '\n';
+    for (size_t i = 0; i < n; ++i) std::format_to(out, "{}\n", id(rng));
+    return text;
+}
+
+// Four rows of numbers and the operator row. A problem is as wide as its longest number,
+// shorter ones are aligned left or right at random.
+inline std::string day06(size_t n, uint64_t seed) {
+    constexpr size_t rows{4};
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<size_t> digits{1, 4};
+    std::uniform_int_distribution<size_t> row{0, rows - 1};
+    std::array<std::string, rows + 1> lines;
+    for (size_t p = 0; p < n; ++p) {
+        const size_t width = digits(rng);
+        const size_t widest = row(rng);
+        for (size_t r = 0; r < rows; ++r) {
+            const size_t len = r == widest ? width : std::uniform_int_distribution<size_t>{1, width}(rng);
+            std::string num(len, '0');
+            detail::fill(num.data(), len, rng, [](uint8_t b) { return static_cast<char>('0' + (b * 10 >> 8)); });
+            num.front() = static_cast<char>('1' + (rng() % 9));
+            if (p > 0) lines[r] += ' ';
+            const bool left = rng() & 1;
+            if (!left) lines[r].append(width - len, ' ');
+            lines[r] += num;
+            if (left) lines[r].append(width - len, ' ');
+        }
+        if (p > 0) lines[rows] += ' ';
+        lines[rows] += (rng() & 1) ? '+' : '*';
+        lines[rows].append(width - 1, ' ');
+    }
+    std::string text;
+    for (const auto& line : lines) {
+        text += line;
+        text += '\n';
+    }
+    return text;
+}
+
+// The source in the middle of the top row, splitters on even rows inside the cone the beam
+// can reach, never two side by side.
+inline std::string day07(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::bernoulli_distribution splitter{0.3};
+    const size_t width = std::max<size_t>(n, 3);
+    const size_t mid = width / 2;
+    std::string text(n * (width + 1), '.');
+    for (size_t y = 0; y < n; ++y) {
+        char* row = text.data() + y * (width + 1);
+        row[width] = '\n';
+        if (y == 0) {
+            row[mid] = 'S';
+            continue;
+        }
+        if (y % 2 != 0) continue;
+        for (size_t x = 1; x + 1 < width; ++x) {
+            const size_t offset = x > mid ? x - mid : mid - x;
+            if (offset <= y / 2 && row[x - 1] != '^' && splitter(rng)) row[x] = '^';
+        }
+    }
+    return text;
+}
+
+inline std::string day08(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<int64_t> coord{0, 99'999};
+    std::string text;
+    auto out = std::back_inserter(text);
+    for (size_t i = 0; i < n; ++i) {
+        const int64_t x = coord(rng), y = coord(rng), z = coord(rng);
+        std::format_to(out, "{},{},{}\n", x, y, z);
+    }
+    return text;
+}
+
+// A simple rectilinear polygon: four monotone staircases, one per quadrant around the centre,
+// meeting on the axes. Every tile is a corner and consecutive tiles share a row or a column.
+inline std::string day09(size_t n, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    const size_t stairs = std::max<size_t>(n / 8, 1); // steps per quadrant
+    const int64_t radius = std::max<int64_t>(50'000, 4 * static_cast<int64_t>(stairs));
+
+    // vertical then horizontal direction: up/left, down/left, down/right, up/right
+    constexpr std::array<std::pair<int, int>, 4> moves{{{1, -1}, {-1, -1}, {-1, 1}, {1, 1}}};
+    std::string text;
+    auto out = std::back_inserter(text);
+    int64_t x = radius, y = 0;
+    for (const auto& [dy, dx] : moves) {
+        const auto vertical = detail::steps(stairs, radius, rng);
+        const auto horizontal = detail::steps(stairs, radius, rng);
+        for (size_t i = 0; i < stairs; ++i) {
+            y += dy * vertical[i];
+            std::format_to(out, "{},{}\n", x + radius + 1, y + radius + 1);
+            x += dx * horizontal[i];
+            std::format_to(out, "{},{}\n", x + radius + 1, y + radius + 1);
+        }
+    }
+    return text;
+}
+
+namespace detail {
+
+// Size of the Day 10 manuals: each one draws its counters and buttons from the ranges, a button
+// covers up to `fanout` counters and is pressed up to `presses` times
+struct ManualShape {
+    size_t manuals{0};
+    size_t counters_lo{3}, counters_hi{10};
+    size_t buttons_lo{3}, buttons_hi{13};
+    size_t fanout{5};
+    int64_t presses{40};
+};
+
+inline std::string manuals(const ManualShape& shape, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    auto uniform = [&rng](size_t lo, size_t hi) { return std::uniform_int_distribution<size_t>{lo, hi}(rng); };
+    std::string text;
+    auto out = std::back_inserter(text);
+    std::vector<std::vector<size_t>> buttons;
+    std::vector<size_t> order;
+    for (size_t m = 0; m < shape.manuals; ++m) {
+        const size_t lights = uniform(shape.counters_lo, shape.counters_hi);
+        buttons.assign(uniform(shape.buttons_lo, shape.buttons_hi), {});
+        order.resize(lights);
+        for (auto& button : buttons) {
+            std::iota(order.begin(), order.end(), size_t{0});
+            std::shuffle(order.begin(), order.end(), rng);
+            button.assign(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(uniform(1, std::min(lights, shape.fanout))));
+        }
+        for (size_t k = 0; k < lights; ++k) {
+            if (std::ranges::none_of(buttons, [k](const auto& b) { return std::ranges::find(b, k) != b.end(); })) {
+                buttons[uniform(0, buttons.size() - 1)].push_back(k);
+            }
+        }
+
+        uint64_t on{0};
+        std::vector<int64_t> joltages(lights, 0);
+        for (auto& button : buttons) {
+            std::ranges::sort(button);
+            const auto presses = std::uniform_int_distribution<int64_t>{0, shape.presses}(rng);
+            for (size_t k : button) joltages[k] += presses;
+            if (rng() & 1) {
+                for (size_t k : button) on ^= uint64_t{1} << k;
+            }
+        }
+
+        text += '[';
+        for (size_t k = 0; k < lights; ++k) text += (on >> k & 1) ? '#' : '.';
+        text += ']';
+        for (const auto& button : buttons) {
+            text += " (";
+            for (size_t i = 0; i < button.size(); ++i) std::format_to(out, "{}{}", i > 0 ? "," : "", button[i]);
+            text += ')';
+        }
+        text += " {";
+        for (size_t k = 0; k < lights; ++k) std::format_to(out, "{}{}", k > 0 ? "," : "", joltages[k]);
+        text += "}\n";
+    }
+    return text;
+}
+
+} // namespace detail
+
+// Up to 10 lights and 13 buttons like the puzzle. The lights are the XOR of a random set of
+// buttons and the joltages the counts of random presses, so both parts are always solvable;
+// more buttons than counters leaves the integer program underdetermined.
+inline std::string day10(size_t n, uint64_t seed) {
+    return detail::manuals({.manuals = n}, seed);
+}
+
+// 16 manuals that get harder with n instead of more numerous: n + 3 counters (at most 60), up
+// to n / 4 + 2 buttons more than counters (at most 64 buttons), so the null space of each
+// manual grows with n, buttons covering up to a third of the counters, and presses up to
+// 40 * n^2 (at most 10^16, so 64 buttons on one counter still fit an int64_t).
+inline std::string day10_hard(size_t n, uint64_t seed) {
+    const size_t counters = std::min<size_t>(n + 3, 60);
+    const size_t free = n / 4 + 2;
+    const int64_t root = static_cast<int64_t>(std::min<size_t>(n, 15'000'000));
+    return detail::manuals({.manuals = 16,
+                            .counters_lo = counters, .counters_hi = counters,
+                            .buttons_lo = std::min<size_t>(counters + 1, 64),
+                            .buttons_hi = std::min<size_t>(counters + free, 64),
+                            .fanout = std::max<size_t>(counters / 3, 2),
+                            .presses = std::min<int64_t>(40 * root * root, 10'000'000'000'000'000)},
+                           seed);
+}
+
+// n puzzle-shaped manuals with presses up to 10^15 and no more buttons than counters, so almost
+// every manual has a unique solution and the exact engine has to carry the joltages itself.
+inline std::string day10_large(size_t n, uint64_t seed) {
+    return detail::manuals({.manuals = n, .counters_lo = 6, .buttons_hi = 6, .presses = 1'000'000'000'000'000},
+                           seed);
+}
+
+struct Generator {
+    std::string_view day;
+    std::string_view variant; // empty for the puzzle-shaped input
+    std::string (*make)(size_t n, uint64_t seed);
+};
+
+inline constexpr std::array<Generator, 12> generators{{
+    {"01", "", day01}, {"02", "", day02}, {"03", "", day03}, {"04", "", day04}, {"05", "", day05},
+    {"06", "", day06}, {"07", "", day07}, {"08", "", day08}, {"09", "", day09}, {"10", "", day10},
+    {"10", "hard", day10_hard},
+    {"10", "large", day10_large},
+}};
+
+inline const Generator* find(std::string_view day, std::string_view variant = {}) {
+    auto it = std::ranges::find_if(generators, [&](const Generator& g) { return g.day == day && g.variant == variant; });
+    return it == generators.end() ? nullptr : &*it;
+}
+
+} // namespace gen
@@ -0,0 +1,138 @@
+// Ingest throughput of the shared input layer against std::getline.
+//
+// Usage: ingest <file> [--reps=N] [--generate=MiB]
+//   --generate writes a synthetic file of puzzle-like lines (numbers and separators) of
+//   the given size to <file> first, e.g. --generate=2048 for a 2 GiB input.
+//   Passing "-" as file reads stdin once, which measures the buffered fallback for pipes:
+//   cat big.txt | ingest -
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <print>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+
+namespace {
+
+// what every reader has to produce, so no variant can skip work the others do
+struct Digest {
+    uint64_t lines{0};
+    uint64_t bytes{0};
+    uint64_t checksum{0};
+
+    void add(std::string_view line) {
+        lines++;
+        bytes += line.size();
+        checksum = checksum * 31 + (line.empty() ? 0 : static_cast<unsigned char>(line.back()));
+    }
+    bool operator==(const Digest&) const = default;
+};
+
+bool generate(const std::filesystem::path& path, uint64_t mib) {
+    std::ofstream out{path, std::ios::binary};
+    if (!out.is_open()) return false;
+
+    std::mt19937_64 rng{2025};
+    std::uniform_int_distribution<int64_t> value{0, 99'999};
+    std::string block;
+    const uint64_t target = mib << 20;
+    for (uint64_t written = 0; written < target; written += block.size()) {
+        block.clear();
+        while (block.size() < (size_t{1} << 20)) {
+            block += std::to_string(value(rng));
+            block += ',';
+            block += std::to_string(value(rng));
+            block += ',';
+            block += std::to_string(value(rng));
+            block += '\n';
+        }
+        out.write(block.data(), static_cast<std::streamsize>(block.size()));
+    }
+    return static_cast<bool>(out);
+}
+
+std::optional<Digest> read_getline(const std::filesystem::path& path) {
+    std::ifstream input_file{path};
+    if (!input_file.is_open()) return std::nullopt;
+    Digest digest;
+    std::string line;
+    while (getline(input_file, line)) digest.add(line);
+    return digest;
+}
+
+std::optional<Digest> read_input(const std::filesystem::path& path) {
+    auto input = aoc::Input::open(path);
+    if (!input) return std::nullopt;
+    Digest digest;
+    for (std::string_view line : input->lines()) digest.add(line);
+    return digest;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::println(stderr, "Usage: {} <file> [--reps=N] [--generate=MiB]", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const std::filesystem::path path{argv[1]};
+    int reps{5};
+    for (int i = 2; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (arg.starts_with("--reps=")) {
+            reps = std::max(1, std::atoi(arg.substr(7).data()));
+        } else if (arg.starts_with("--generate=")) {
+            const uint64_t mib = std::strtoull(arg.substr(11).data(), nullptr, 10);
+            if (!generate(path, mib)) {
+                std::println(stderr, "Failed to write {}", path.string());
+                return EXIT_FAILURE;
+            }
+        } else {
+            std::println(stderr, "Unknown option: {}", arg);
+            return EXIT_FAILURE;
+        }
+    }
+
+    using Reader = std::optional<Digest> (*)(const std::filesystem::path&);
+    struct Variant {
+        std::string_view name;
+        Reader read;
+    };
+    std::vector<Variant> variants{{"aoc::Input", read_input}};
+    // stdin can only be consumed once
+    if (path != "-") variants.insert(variants.begin(), {"std::getline", read_getline});
+
+    // the first pass also warms the page cache, so every variant is timed on a hot cache
+    std::optional<Digest> expected;
+    for (const auto& [name, read] : variants) {
+        std::vector<double> seconds;
+        for (int r = 0; r < (path == "-" ? 1 : reps); ++r) {
+            const auto start = std::chrono::steady_clock::now();
+            auto digest = read(path);
+            seconds.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            if (!digest) {
+                std::println(stderr, "Failed to open input file: {}", path.string());
+                return EXIT_FAILURE;
+            }
+            if (!expected) expected = digest;
+            if (*digest != *expected) {
+                std::println(stderr, "{} read different lines than {}", name, variants.front().name);
+                return EXIT_FAILURE;
+            }
+        }
+        std::ranges::sort(seconds);
+        const double mib = static_cast<double>(expected->bytes + expected->lines) / (1 << 20);
+        std::println("{:<14} {:>10} lines  best {:8.1f} MiB/s  median {:8.1f} MiB/s",
+                     name, expected->lines, mib / seconds.front(), mib / seconds[seconds.size() / 2]);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,140 @@
+// Integer list parsing: aoc::parse_list against the from_chars loops the days used before.
+//
+// Usage: parse [--mib=N] [--reps=N]
+// Each format is generated in memory (N MiB, 64 by default) in the shape of one day's input,
+// then parsed line by line by both variants; the sums must agree. Rates are best of N runs.
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <print>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+
+namespace {
+
+struct Format {
+    std::string_view name;
+    char sep;
+    std::function<std::string(std::mt19937_64&)> line;
+};
+
+// the loop Days 08-10 used: number, skip one separator, repeat
+int64_t sum_from_chars(std::string_view text, char sep) {
+    int64_t sum{0};
+    for (std::string_view line : aoc::lines(text)) {
+        const char* ptr = line.data();
+        const char* end = ptr + line.size();
+        while (ptr < end) {
+            while (sep == ' ' && ptr < end && *ptr == ' ') ptr++;
+            if (ptr == end) break;
+            int64_t value;
+            auto [next, ec] = std::from_chars(ptr, end, value);
+            if (ec != std::errc()) return -1;
+            sum += value;
+            ptr = next;
+            if (ptr < end && *ptr == sep) ptr++;
+        }
+    }
+    return sum;
+}
+
+int64_t sum_parse_list(std::string_view text, char sep) {
+    int64_t sum{0};
+    std::array<int64_t, 64> values;
+    for (std::string_view line : aoc::lines(text)) {
+        auto count = aoc::parse_list(line, sep, std::span{values});
+        if (!count) return -1;
+        for (size_t i = 0; i < *count; i++) sum += values[i];
+    }
+    return sum;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t mib{64};
+    int reps{5};
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (arg.starts_with("--mib=")) {
+            mib = std::max<size_t>(1, std::strtoull(arg.substr(6).data(), nullptr, 10));
+        } else if (arg.starts_with("--reps=")) {
+            reps = std::max(1, std::atoi(arg.substr(7).data()));
+        } else {
+            std::println(stderr, "Usage: {} [--mib=N] [--reps=N]", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto uniform = [](std::mt19937_64& rng, int64_t lo, int64_t hi) {
+        return std::uniform_int_distribution<int64_t>{lo, hi}(rng);
+    };
+    const std::vector<Format> formats{
+        {"ranges (05)", '-', [&](std::mt19937_64& rng) {
+            const int64_t start = uniform(rng, 1, 500'000'000'000'000);
+            return std::format("{}-{}", start, start + uniform(rng, 0, 10'000'000'000'000));
+        }},
+        {"columns (06)", ' ', [&](std::mt19937_64& rng) {
+            std::string line;
+            for (int i = 0; i < 32; i++) line += std::format("{:>4} ", uniform(rng, 1, 9999));
+            return line;
+        }},
+        {"x,y,z (08)", ',', [&](std::mt19937_64& rng) {
+            return std::format("{},{},{}", uniform(rng, 0, 99'999), uniform(rng, 0, 99'999), uniform(rng, 0, 99'999));
+        }},
+        {"x,y (09)", ',', [&](std::mt19937_64& rng) {
+            return std::format("{},{}", uniform(rng, 0, 99'999), uniform(rng, 0, 99'999));
+        }},
+        {"lists (10)", ',', [&](std::mt19937_64& rng) {
+            std::string line = std::to_string(uniform(rng, 0, 300));
+            for (int64_t i = uniform(rng, 1, 9); i > 0; i--) line += std::format(",{}", uniform(rng, 0, 300));
+            return line;
+        }},
+    };
+
+    for (const auto& format : formats) {
+        std::mt19937_64 rng{2025};
+        std::string text;
+        text.reserve(mib << 20);
+        while (text.size() < (mib << 20)) {
+            text += format.line(rng);
+            text += '\n';
+        }
+
+        // alternate the variants so both see the same machine noise, and keep the best run
+        double baseline_best{1e300}, best{1e300};
+        int64_t baseline_sum{0}, sum{0};
+        auto run = [&](auto&& parse, double& fastest) {
+            const auto start = std::chrono::steady_clock::now();
+            const int64_t result = parse(text, format.sep);
+            fastest = std::min(fastest, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            return result;
+        };
+        for (int r = 0; r < reps; ++r) {
+            baseline_sum = run(sum_from_chars, baseline_best);
+            sum = run(sum_parse_list, best);
+        }
+        const double size_mib = static_cast<double>(text.size()) / (1 << 20);
+        const double baseline = size_mib / baseline_best;
+        const double rate = size_mib / best;
+        if (sum != baseline_sum) {
+            std::println(stderr, "{}: parse_list sum {} differs from from_chars sum {}", format.name, sum, baseline_sum);
+            return EXIT_FAILURE;
+        }
+        std::println("{:<14} from_chars {:8.1f} MiB/s  parse_list {:8.1f} MiB/s  ({:.2f}x)",
+                     format.name, baseline, rate, rate / baseline);
+    }
+    return EXIT_SUCCESS;
+}
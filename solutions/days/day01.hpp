@@ -0,0 +1,193 @@
+// Advent of Code Day 1
+// https://adventofcode.com/2025/day/1
+
+#pragma once
+
+#include <algorithm>
+#include <barrier>
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../aoc/parse.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day01 {
+
+// Both answers come out of one pass over the log, which is never held in memory as a whole
+struct Input {
+    int64_t landings{0};  // rotations that end on 0
+    int64_t crossings{0}; // clicks that pass or land on 0
+};
+
+namespace detail {
+
+inline constexpr int64_t start_position{50};
+
+// Each thread takes one chunk of this many bytes per window, so a window of rotations stays
+// in cache between its two passes and memory does not grow with the log
+inline constexpr size_t chunk_bytes{1 << 20};
+
+struct Chunk {
+    std::vector<int64_t> rotations; // signed: L is negative
+    int64_t offset{0};              // net rotation of the chunk mod 100
+    int64_t start{0};               // dial before the first rotation
+    int64_t landings{0};
+    int64_t crossings{0};
+    const char* error_at{nullptr};
+    std::string error{};
+};
+
+// start of the first line at or after pos, so neighbouring chunks share their boundary
+inline size_t line_start(std::string_view text, size_t pos) {
+    if (pos == 0) return 0;
+    if (pos >= text.size()) return text.size();
+    const size_t newline = text.find('\n', pos - 1);
+    return newline == std::string_view::npos ? text.size() : newline + 1;
+}
+
+/* First pass: one "L68" or "R14" per line into chunk.rotations. The SWAR parser finds the end of
+ * the number with the same load that converts it, so no separate newline search is needed. Blank
+ * lines, "\n" or "\r\n", are rotations by 0, the reference still checks the dial after them.
+ */
+inline void scan(std::string_view text, Chunk& chunk) {
+    chunk.rotations.clear();
+    chunk.offset = 0;
+    const char* p = text.data();
+    const char* const end = p + text.size();
+    auto fail = [&chunk](const char* at, std::string message) {
+        chunk.error_at = at;
+        chunk.error = std::move(message);
+    };
+
+    int64_t offset{0};
+    while (p < end) {
+        if (*p == '\n' || (*p == '\r' && (p + 1 == end || p[1] == '\n'))) {
+            chunk.rotations.push_back(0);
+            p += (*p == '\r' && p + 1 < end) ? 2 : 1;
+            continue;
+        }
+        const char direction = *p;
+        if (direction != 'L' && direction != 'R') return fail(p, "expected L or R");
+
+        std::string_view rest{p + 1, static_cast<size_t>(end - p - 1)};
+        auto clicks = aoc::parse_int<uint64_t>(rest);
+        if (!clicks) return fail(p + 1, clicks.error());
+        if (*clicks > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) return fail(p + 1, "number out of range");
+        p = rest.data();
+        if (p < end && *p == '\r') p++;
+        if (p < end && *p++ != '\n') return fail(p - 1, "unexpected characters after number");
+
+        const auto rotation = static_cast<int64_t>(*clicks);
+        chunk.rotations.push_back(direction == 'L' ? -rotation : rotation);
+        offset += direction == 'L' ? -(rotation % 100) : rotation % 100;
+    }
+    chunk.offset = (offset % 100 + 100) % 100;
+}
+
+/* Second pass, once the carry fix-up has given the chunk its start position.
+ * A left turn from d is a right turn from 100 - d on a mirrored dial, with the same zeros
+ * passed, so both directions share one branch-free step. Full turns pass 0 once each and do
+ * not depend on the dial, so the chain from one position to the next is only an add and two
+ * compares; the divisions by 100 run ahead of it.
+ */
+inline void count(Chunk& chunk) {
+    int64_t dial = chunk.start;
+    int64_t landings{0}, crossings{0};
+    for (const int64_t rotation : chunk.rotations) {
+        const bool left = rotation < 0;
+        const int64_t clicks = left ? -rotation : rotation;
+        crossings += clicks / 100;
+        const int64_t mirrored = left && dial != 0 ? 100 - dial : dial;
+        const int64_t moved = mirrored + clicks % 100;
+        const bool wrapped = moved >= 100;
+        crossings += wrapped;
+        const int64_t turned = wrapped ? moved - 100 : moved;
+        dial = left && turned != 0 ? 100 - turned : turned;
+        landings += dial == 0;
+    }
+    chunk.landings = landings;
+    chunk.crossings = crossings;
+}
+
+} // namespace detail
+
+/* Streams the log through windows of threads * chunk_bytes. Every thread parses its chunk of the
+ * window and sums its rotations mod 100; the barrier's completion step turns those offsets into
+ * start positions with an exclusive prefix sum mod 100, carried on from the previous window; then
+ * every thread replays its chunk from its own start and counts independently.
+ */
+inline std::expected<Input, std::string> simulate(std::string_view text, unsigned threads) {
+    threads = static_cast<unsigned>(std::clamp<size_t>(text.size() / detail::chunk_bytes + 1, 1, std::max(threads, 1u)));
+    std::vector<detail::Chunk> chunks(threads);
+    for (auto& chunk : chunks) chunk.rotations.reserve(detail::chunk_bytes / 3);
+
+    int64_t carry{detail::start_position};
+    bool failed{false};
+    std::barrier sync{static_cast<std::ptrdiff_t>(threads), [&]() noexcept {
+        for (auto& chunk : chunks) {
+            failed |= chunk.error_at != nullptr;
+            chunk.start = carry;
+            carry = (carry + chunk.offset) % 100;
+        }
+    }};
+
+    auto work = [&](unsigned t) {
+        detail::Chunk& chunk = chunks[t];
+        const size_t window = threads * detail::chunk_bytes;
+        int64_t landings{0}, crossings{0};
+        for (size_t base = 0; detail::line_start(text, base) < text.size(); base += window) {
+            const size_t from = detail::line_start(text, base + t * detail::chunk_bytes);
+            const size_t to = detail::line_start(text, base + (t + 1) * detail::chunk_bytes);
+            detail::scan(text.substr(from, to - from), chunk);
+            sync.arrive_and_wait();
+            if (failed) break;
+            detail::count(chunk);
+            landings += chunk.landings;
+            crossings += chunk.crossings;
+        }
+        chunk.landings = landings;
+        chunk.crossings = crossings;
+    };
+    {
+        std::vector<std::jthread> pool;
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(work, t);
+        work(0);
+    }
+
+    Input input;
+    const char* error_at{nullptr};
+    for (const auto& chunk : chunks) {
+        if (chunk.error_at != nullptr && (error_at == nullptr || chunk.error_at < error_at)) error_at = chunk.error_at;
+        input.landings += chunk.landings;
+        input.crossings += chunk.crossings;
+    }
+    if (error_at != nullptr) {
+        const auto& chunk = *std::ranges::find(chunks, error_at, &detail::Chunk::error_at);
+        const std::string_view before = text.substr(0, static_cast<size_t>(error_at - text.data()));
+        const size_t line = static_cast<size_t>(std::ranges::count(before, '\n')) + 1;
+        const size_t column = before.size() - (before.rfind('\n') + 1) + 1; // npos + 1 wraps to 0
+        return std::unexpected(std::format("Invalid rotation on line {}: {} at column {}", line, chunk.error, column));
+    }
+    return input;
+}
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day01/parse");
+    return simulate(text, std::max(1u, std::thread::hardware_concurrency()));
+}
+
+inline int64_t part1(const Input& input) {
+    return input.landings;
+}
+
+inline int64_t part2(const Input& input) {
+    return input.crossings;
+}
+
+} // namespace day01
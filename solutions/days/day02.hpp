@@ -0,0 +1,147 @@
+// Advent of Code Day 2
+// https://adventofcode.com/2025/day/2
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day02 {
+
+struct Range {
+    int64_t start;
+    int64_t end;
+};
+
+using Input = std::vector<Range>;
+
+// Comma separated "start-end" ranges, on one line or wrapped over several
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day02/parse");
+    Input input;
+    input.reserve(static_cast<size_t>(std::ranges::count(text, ',')) + 1);
+    size_t line_number{0};
+    for (std::string_view line : aoc::lines(text)) {
+        line_number++;
+        while (!line.empty()) {
+            const size_t comma = std::min(line.find(','), line.size());
+            const std::string_view field = line.substr(0, comma);
+            line.remove_prefix(std::min(comma + 1, line.size()));
+            if (field.empty()) continue;
+
+            std::array<int64_t, 2> bounds;
+            if (auto parsed = aoc::parse_fixed(field, '-', std::span{bounds}); !parsed) {
+                return std::unexpected(std::format("Invalid range {} on line {}: {}", field, line_number, parsed.error()));
+            }
+            if (bounds[0] > bounds[1]) {
+                return std::unexpected(std::format("Invalid range {} on line {}: start after end", field, line_number));
+            }
+            input.push_back({bounds[0], bounds[1]});
+        }
+    }
+    return input;
+}
+
+namespace detail {
+
+// every int64_t has at most 19 digits
+inline constexpr int max_digits{19};
+
+inline constexpr std::array<uint64_t, max_digits + 1> powers = [] {
+    std::array<uint64_t, max_digits + 1> p{};
+    p[0] = 1;
+    for (size_t i = 1; i < p.size(); i++) p[i] = p[i - 1] * 10;
+    return p;
+}();
+
+// Möbius function of the small numbers that can be repetition counts
+inline constexpr std::array<int, max_digits + 1> mobius = [] {
+    std::array<int, max_digits + 1> mu{};
+    for (int n = 1; n <= max_digits; n++) {
+        int m = n, value = 1;
+        for (int p = 2; p <= m; p++) {
+            if (m % p != 0) continue;
+            m /= p;
+            if (m % p == 0) {
+                value = 0;
+                break;
+            }
+            value = -value;
+        }
+        mu[static_cast<size_t>(n)] = value;
+    }
+    return mu;
+}();
+
+/* Sum of the numbers in [lo, hi] made of a block of `block` digits written digits / block times.
+ * Such a number is the block times M = 10^(digits - block) + ... + 10^block + 1, so the blocks
+ * that land in the range are consecutive and their sum is an arithmetic series.
+ * lo and hi must both have `digits` digits.
+ */
+inline __int128 repeated_sum(uint64_t lo, uint64_t hi, int digits, int block) {
+    const uint64_t multiplier = (powers[static_cast<size_t>(digits)] - 1) / (powers[static_cast<size_t>(block)] - 1);
+    const uint64_t first = std::max(powers[static_cast<size_t>(block - 1)], (lo + multiplier - 1) / multiplier);
+    const uint64_t last = std::min(powers[static_cast<size_t>(block)] - 1, hi / multiplier);
+    if (first > last) return 0;
+    const auto count = static_cast<__int128>(last - first + 1);
+    return static_cast<__int128>(multiplier) * ((static_cast<__int128>(first) + last) * count / 2);
+}
+
+/* Sum of the invalid IDs in a range, taken one digit count at a time so every candidate has a
+ * fixed length. Part 1 only counts a block written twice. Part 2 counts a block written any
+ * number of times, and a number like 111111 repeats with blocks of 1, 2 and 3 digits. The numbers
+ * with r repetitions also have every repetition count that divides r, so over the prime factors
+ * of the length inclusion–exclusion reduces to the Möbius sum
+ *   sum over d | digits, d > 1 of -mu(d) * repeated_sum(block = digits / d)
+ * which counts every number once, with a handful of series per length whatever the range width.
+ */
+inline __int128 invalid_sum(const Range& range, bool any_repetition) {
+    __int128 total{0};
+    for (int digits = 2; digits <= max_digits; digits++) {
+        const uint64_t lo = std::max(static_cast<uint64_t>(range.start), powers[static_cast<size_t>(digits - 1)]);
+        const uint64_t hi = std::min(static_cast<uint64_t>(range.end), powers[static_cast<size_t>(digits)] - 1);
+        if (lo > hi) continue;
+        if (!any_repetition) {
+            if (digits % 2 == 0) total += repeated_sum(lo, hi, digits, digits / 2);
+            continue;
+        }
+        for (int d = 2; d <= digits; d++) {
+            const int mu = mobius[static_cast<size_t>(d)];
+            if (digits % d != 0 || mu == 0) continue;
+            total -= mu * repeated_sum(lo, hi, digits, digits / d);
+        }
+    }
+    return total;
+}
+
+// sums past int64_t wrap like the other days' answers
+inline int64_t total(const Input& input, bool any_repetition) {
+    __int128 sum{0};
+    for (const Range& range : input) sum += invalid_sum(range, any_repetition);
+    return static_cast<int64_t>(sum);
+}
+
+} // namespace detail
+
+inline int64_t part1(const Input& input) {
+    AOC_PHASE("day02/part1");
+    return detail::total(input, false);
+}
+
+inline int64_t part2(const Input& input) {
+    AOC_PHASE("day02/part2");
+    return detail::total(input, true);
+}
+
+} // namespace day02
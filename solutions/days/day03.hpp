@@ -0,0 +1,180 @@
+// Advent of Code Day 3
+// https://adventofcode.com/2025/day/3
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day03 {
+
+template <std::size_t N>
+constexpr std::expected<std::int64_t, std::string> best_digits_value(std::string_view line) {
+    if (line.size() < N) {
+        return std::unexpected("line too short");
+    }
+    auto digit = [](char c) -> std::expected<std::int64_t, std::string> {
+        if (c < '0' || c > '9') {
+            return std::unexpected("non-digit");
+        }
+        return static_cast<std::int64_t>(c - '0');
+    };
+
+    std::array<std::int64_t, N> joltages{};
+    auto first = digit(line[0]);
+    if (!first) {
+        return std::unexpected("invalid digits");
+    }
+    joltages[0] = *first;
+
+    // search biggest possible digit for current index, search next digit starting from there
+    std::int32_t current = 1;
+    for (std::size_t result_idx = 0; result_idx < N; result_idx++) {
+        auto last_possible_idx = static_cast<std::int32_t>(line.size() - (N - result_idx));
+        for (std::int32_t line_idx = current; line_idx <= last_possible_idx; line_idx++) {
+            auto value = digit(line[line_idx]);
+            if (!value) {
+                return std::unexpected("invalid digits");
+            }
+            if (*value > joltages[result_idx]) {
+                joltages[result_idx] = *value;
+                current = line_idx + 1;
+                if (joltages[result_idx] == 9) break;
+            }
+        }
+    }
+
+    std::int64_t line_value = 0;
+    for (std::int64_t d : joltages) {
+        line_value = line_value * 10 + d;
+    }
+    return line_value;
+}
+
+struct Input {
+    std::vector<std::string_view> banks;      // one line of battery joltages each
+    std::vector<std::size_t> skipped_lines;   // lines that are not all digits
+};
+
+// The parse without its probe phase, so it can also run at compile time
+constexpr Input parse_banks(std::string_view text) {
+    Input input;
+    std::size_t line_number = 0;
+    for (std::string_view line : aoc::lines(text)) {
+        line_number++;
+        if (line.find_first_not_of("0123456789") != std::string_view::npos) {
+            input.skipped_lines.push_back(line_number);
+            continue;
+        }
+        input.banks.push_back(line);
+    }
+    return input;
+}
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day03/parse");
+    return parse_banks(text);
+}
+
+// Sum over all banks of the largest N-digit joltage, banks shorter than N count nothing
+template <std::size_t N>
+constexpr std::int64_t total_joltage(const Input& input) {
+    std::int64_t total = 0;
+    for (std::string_view bank : input.banks) {
+        total += best_digits_value<N>(bank).value_or(0);
+    }
+    return total;
+}
+
+inline std::int64_t part1(const Input& input) {
+    AOC_PHASE("day03/part1");
+    return total_joltage<2>(input);
+}
+
+// part 2: 12 digits instead of 2
+inline std::int64_t part2(const Input& input) {
+    AOC_PHASE("day03/part2");
+    return total_joltage<12>(input);
+}
+
+/* Both totals in one pass over a NUL-terminated character array, for inputs embedded at compile
+ * time (see aoc/embed.hpp). GCC's constant evaluator keeps every pointer and string_view it forms
+ * alive until the end, so parse_banks runs out of memory long before a full-size input is done;
+ * plain indices into the array stay cheap. The best pair is the best earlier digit followed by
+ * the current one, and the best 12 digits are a stack that pops smaller digits while enough of
+ * the bank is left to refill it. Skips the same lines as parse_banks and counts the same banks.
+ */
+template <std::size_t M>
+constexpr std::array<std::int64_t, 2> embedded_totals(const char (&text)[M]) {
+    constexpr std::size_t size = M - 1;
+    std::int64_t total2 = 0, total12 = 0;
+    std::size_t begin = 0;
+    while (begin < size) {
+        std::size_t end = begin;
+        while (end < size && text[end] != '\n') end++;
+        const std::size_t next = end + 1;
+        if (end > begin && text[end - 1] == '\r') end--;
+
+        bool digits = true;
+        for (std::size_t i = begin; i < end; i++) digits &= text[i] >= '0' && text[i] <= '9';
+        if (digits) {
+            std::int64_t first = -1, pair = 0;
+            char stack[12]{};
+            std::size_t depth = 0;
+            for (std::size_t i = begin; i < end; i++) {
+                const char c = text[i];
+                if (first >= 0 && first * 10 + (c - '0') > pair) pair = first * 10 + (c - '0');
+                if (c - '0' > first) first = c - '0';
+                while (depth > 0 && stack[depth - 1] < c && depth + (end - i) > 12) depth--;
+                if (depth < 12) stack[depth++] = c;
+            }
+            if (end - begin >= 2) total2 += pair;
+            if (end - begin >= 12) {
+                std::int64_t value = 0;
+                for (char d : stack) value = value * 10 + (d - '0');
+                total12 += value;
+            }
+        }
+        begin = next;
+    }
+    return {total2, total12};
+}
+
+// Self-test of the compile-time path: the puzzle example, and a text with CRLF, short and invalid
+// lines, must give the same totals through the runtime parse as through embedded_totals
+namespace detail {
+
+inline constexpr char example[] =
+    "987654321111111\n"
+    "811111111111119\n"
+    "234234234234278\n"
+    "818181911112111\n";
+
+inline constexpr char awkward[] =
+    "1119111911191119\r\n"
+    "7\n"
+    "\n"
+    "12a456789012345\n"
+    "98765432101234567890\r\n"
+    "5555555555555";
+
+template <std::size_t M>
+constexpr bool matches_runtime(const char (&text)[M]) {
+    const Input banks = parse_banks(std::string_view{text, M - 1});
+    return embedded_totals(text) == std::array{total_joltage<2>(banks), total_joltage<12>(banks)};
+}
+
+static_assert(embedded_totals(example) == std::array<std::int64_t, 2>{357, 3121910778619});
+static_assert(matches_runtime(example));
+static_assert(matches_runtime(awkward));
+
+} // namespace detail
+
+} // namespace day03
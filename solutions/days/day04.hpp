@@ -0,0 +1,97 @@
+// Advent of Code Day 4
+// https://adventofcode.com/2025/day/4
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "../aoc/input.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day04 {
+
+constexpr char paper{'@'};
+constexpr char empty{'.'};
+
+template <typename Grid>
+bool inBounds(const Grid& g, int x, int y) {
+    return x >= 0 && y >= 0 && x < static_cast<int>(g.width) && y < static_cast<int>(g.height);
+}
+
+template <typename Grid>
+int countAdjacent(const Grid& g, int x, int y, char value) {
+    static constexpr std::array<std::pair<int,int>, 8> dirs{{
+        {-1, -1}, {0, -1}, {1, -1},
+        {-1,  0},          {1,  0},
+        {-1,  1}, {0,  1}, {1,  1},
+    }};
+    int count{0};
+
+    for (auto [dx, dy] : dirs) {
+        const int nx = x + dx;
+        const int ny = y + dy;
+        if (inBounds(g, nx, ny) && g(ny, nx) == value)
+            count++;
+    }
+
+    return count;
+}
+
+struct Input {
+    std::string_view text;
+    aoc::GridView grid;
+};
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day04/parse");
+    auto grid = aoc::make_grid(text);
+    if (!grid) {
+        return std::unexpected("Invalid grid: " + grid.error());
+    }
+    return Input{text, *grid};
+}
+
+// rolls of paper a forklift can reach: fewer than four rolls around them. On an editable
+// grid they can be removed right away, which frees their neighbours within the same scan.
+template <typename Grid>
+int64_t accessible(const Grid& grid, bool remove) {
+    int64_t count{0};
+    for (int i = 0; i < static_cast<int>(grid.height); i++) {
+        for (int j = 0; j < static_cast<int>(grid.width); j++) {
+            if (grid(i, j) != paper) continue;
+            if (countAdjacent(grid, j, i, paper) < 4) {
+                count++;
+                if constexpr (std::is_same_v<Grid, aoc::Grid>) {
+                    if (remove) grid(i, j) = empty;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+inline int64_t part1(const Input& input) {
+    AOC_PHASE("day04/part1");
+    return accessible(input.grid, false);
+}
+
+// Part 2: keep removing reachable rolls, in place while scanning, until none are left.
+// Works on a copy so the input can be solved again.
+inline int64_t part2(const Input& input) {
+    AOC_PHASE("day04/part2");
+    std::string cells{input.text};
+    auto grid = aoc::make_grid(std::span<char>{cells.data(), cells.size()});
+    int64_t removed_total{0};
+    for (int64_t removed = 1; removed > 0; removed_total += removed) {
+        removed = accessible(*grid, true);
+    }
+    return removed_total;
+}
+
+} // namespace day04
@@ -0,0 +1,131 @@
+// Advent of Code Day 5
+// https://adventofcode.com/2025/day/5
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day05 {
+
+struct Range {
+    int64_t start;
+    int64_t end;
+    auto operator<=>(const Range&) const = default;
+};
+
+struct Input {
+    std::vector<Range> ranges;
+    std::vector<int64_t> ingredients;
+};
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day05/parse");
+    Input input;
+    // the blank line splits the text into ranges and ingredients
+    const size_t split = std::min(text.find("\n\n"), text.size());
+    input.ranges.reserve(aoc::line_count(text.substr(0, split)));
+    input.ingredients.reserve(aoc::line_count(text.substr(split)));
+
+    // preload ingredients, they follow the ranges after a blank line
+    bool in_ranges{true};
+    size_t line_number{0};
+    for (std::string_view line : aoc::lines(text)) {
+        line_number++;
+        if (in_ranges) {
+            if (line.empty()) {
+                in_ranges = false;
+                continue;
+            }
+            std::array<int64_t, 2> bounds;
+            if (auto parsed = aoc::parse_fixed(line, '-', std::span{bounds}); !parsed) {
+                return std::unexpected(std::format("Invalid range on line {}: {}", line_number, parsed.error()));
+            }
+            input.ranges.push_back({bounds[0], bounds[1]});
+            continue;
+        }
+
+        if (line.empty()) continue;
+        auto id = aoc::parse_number<int64_t>(line);
+        if (!id) {
+            return std::unexpected(std::format("Invalid ingredient on line {}: {}", line_number, id.error()));
+        }
+        input.ingredients.push_back(*id);
+    }
+    return input;
+}
+
+/* The numbers are very large so saving every ingredient doesnt seem reasonable. 
+ * Sort ranges and combine them in new vector to improve speed.
+ * While bigger than start -> fresh if smaller than end.
+ * If smaller than start -> spoiled.
+*/
+inline std::vector<Range> merge_ranges(std::vector<Range> ranges) {
+    AOC_PHASE("day05/merge");
+    std::sort(ranges.begin(), ranges.end());
+
+    std::vector<Range> merged;
+    merged.reserve(ranges.size());
+    for (const Range& range : ranges) {
+        // if overlap or adjacent, merge
+        if (!merged.empty() && range.start <= merged.back().end) {
+            merged.back().end = std::max(merged.back().end, range.end);
+        } else {
+            merged.push_back(range);
+        }
+    }
+    return merged;
+}
+
+inline int64_t part1(const Input& input) {
+    AOC_PHASE("day05/part1");
+    const std::vector<Range> merged = merge_ranges(input.ranges);
+
+    // measuring difference in speed between linear and binary out of curiousity
+    // binary ~2x the speed even with such a small sample size
+    int64_t count{0};
+    for (int64_t id : input.ingredients) {
+        /* ~146 micro seconds */
+        // for (auto range : merged) {
+        //     if (id < range.start) break;
+        //     if (id <= range.end) {
+        //         count++;
+        //         break;
+        //     }
+        // }
+
+        /* ~78 micro seconds */
+        auto it = std::upper_bound(merged.begin(), merged.end(), id, 
+            [](int64_t val, const Range& r) { return val < r.start; });
+
+        if (it != merged.begin()) {
+            if (id <= std::prev(it)->end) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+// part 2: count how many IDs are considered fresh
+inline int64_t part2(const Input& input) {
+    AOC_PHASE("day05/part2");
+    int64_t fresh{0};
+    for (auto const range : merge_ranges(input.ranges)) {
+        fresh += range.end - range.start + 1;
+    }
+    return fresh;
+}
+
+} // namespace day05
@@ -0,0 +1,144 @@
+// Advent of Code Day 6
+// https://adventofcode.com/2025/day/6
+
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day06 {
+
+enum Operator {
+    TIMES,
+    PLUS
+};
+
+struct Problem {
+    std::vector<int64_t> nums;
+    Operator op;
+    int32_t start;
+};
+
+struct Input {
+    // views into the input, the worksheet itself is never copied
+    std::vector<std::string_view> homework;
+    std::vector<Problem> problems;
+};
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day06/parse");
+    constexpr auto add{'+'};
+    constexpr auto mult{'*'};
+
+    Input input;
+    auto& homework = input.homework;
+    auto& problems = input.problems;
+    for (std::string_view l : aoc::lines(text)) homework.push_back(l);
+    if (homework.empty()) {
+        return std::unexpected("Empty worksheet");
+    }
+    std::string_view op_str = homework.back();
+
+    // every row but the last holds one number per problem
+    std::vector<int64_t> row_nums;
+    for (size_t row = 0; row + 1 < homework.size(); row++) {
+        row_nums.clear();
+        if (auto parsed = aoc::parse_list(homework[row], ' ', row_nums); !parsed) {
+            return std::unexpected(std::format("Invalid number on line {}: {}", row + 1, parsed.error()));
+        }
+        if (row_nums.size() > problems.size()) problems.resize(row_nums.size());
+        for (size_t col_idx = 0; col_idx < row_nums.size(); col_idx++) {
+            problems[col_idx].nums.push_back(row_nums[col_idx]);
+        }
+    }
+
+    // the operator row also fixes where each problem starts
+    size_t col_idx{0};
+    for (std::string_view field : aoc::fields(op_str)) {
+        if (col_idx >= problems.size() || field.size() != 1 || (field.front() != add && field.front() != mult)) {
+            return std::unexpected(std::format("Invalid operator '{}' in column {}", field, field.data() - op_str.data() + 1));
+        }
+        problems[col_idx].op = field.front() == add ? PLUS : TIMES;
+        problems[col_idx].start = static_cast<int32_t>(field.data() - op_str.data());
+        col_idx++;
+    }
+    return input;
+}
+
+inline int64_t part1(const Input& input) {
+    AOC_PHASE("day06/part1");
+    int64_t total{0};
+    for (const auto& problem : input.problems) {
+        // std::println("{}", problem);
+        int64_t problem_res{0};
+        if (problem.op == TIMES) {
+            problem_res = 1;
+            for (auto num : problem.nums)
+                problem_res *= num;
+        } else {
+            for (auto num : problem.nums)
+                problem_res += num;
+        }
+        total += problem_res;
+    }
+    return total;
+}
+
+// Part 2: Read numbers from top to bottom in a straight line. So whitespace matters
+inline int64_t part2(const Input& input) {
+    AOC_PHASE("day06/part2");
+    const auto& homework = input.homework;
+    const auto& problems = input.problems;
+    // a problem ends one column before the next starts, the last one at the end of the row
+    auto end_of = [&](size_t i) {
+        return i + 1 < problems.size() ? problems[i + 1].start - 1
+                                       : static_cast<int32_t>(homework.back().length());
+    };
+
+    // iterate column by column and add the result based on the operation
+    int64_t total{0};
+    for (size_t i = 0; i < problems.size(); i++) {
+        int64_t problem_res{ problems[i].op == TIMES ? 1 : 0 };
+        for (int32_t j = problems[i].start; j < end_of(i); j++) {
+            int64_t column{0};
+            for (size_t row = 0; row + 1 < homework.size(); row++) {
+                if (static_cast<size_t>(j) < homework[row].size() && homework[row][j] != ' ') {
+                    column = column * 10 + (homework[row][j] - '0');
+                }
+            }
+
+            if (problems[i].op == TIMES) {
+                problem_res *= column;
+            } else {
+                problem_res += column;
+            }
+        }
+
+        total += problem_res;
+    }
+    return total;
+}
+
+} // namespace day06
+
+template <>
+struct std::formatter<day06::Problem> : std::formatter<std::string> {
+    auto format(const day06::Problem& p, std::format_context& ctx) const {
+        char op_char = (p.op == day06::TIMES) ? '*' : '+';
+        auto out = std::format_to(ctx.out(), "Op: '{}', Col: {}, Nums: [", op_char, p.start);
+
+        for (size_t i = 0; i < p.nums.size(); ++i) {
+            if (i > 0) out = std::format_to(out, ", ");
+            out = std::format_to(out, "{}", p.nums[i]);
+        }
+        return std::format_to(out, "]");
+    }
+};
@@ -0,0 +1,497 @@
+// Advent of Code Day 7
+// https://adventofcode.com/2025/day/7
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day07 {
+
+enum Tile {
+    Manifold = 1,
+    Empty = 0,
+    Splitter = -1
+};
+
+struct Input {
+    std::vector<int64_t> grid; // Tile values, row-major
+    size_t width{0};
+    size_t height{0};
+};
+
+// The grid alone, for the engines below; parse() also runs the propagation
+inline std::expected<Input, std::string> parse_grid(std::string_view text) {
+    AOC_PHASE("day07/parse");
+    constexpr char man{'S'};
+    constexpr char split{'^'};
+
+    // flat contiguous vector for faster access, sized from the first row and the line count
+    // so it is allocated once
+    Input input;
+    auto& grid = input.grid;
+    size_t& width = input.width;
+    size_t& height = input.height;
+
+    // convert symbols to ints that can be added up to calculate part 2 later
+    for (std::string_view line : aoc::lines(text)) {
+        if (line.empty()) continue;
+        if (width == 0) {
+            width = line.size();
+            grid.reserve(width * aoc::line_count(text));
+        }
+        if (line.size() < width) {
+            return std::unexpected(std::format("Row {} is shorter than the first row", height + 1));
+        }
+
+        for (size_t c = 0; c < width; c++) {
+            int32_t t{Tile::Empty};
+            
+            if (line[c] == man) {
+                t = Tile::Manifold;
+            } else if (line[c] == split) {
+                t = Tile::Splitter;
+            }
+            grid.push_back(t);
+        }
+        height++;
+    }
+    if (height == 0) {
+        return std::unexpected("Empty grid");
+    }
+    return input;
+}
+
+/* Counters past int64_t.
+ * Every stacked splitter doubles the timelines, so deep manifolds pass 2^63 after about 63 of
+ * them and an int64_t count wraps. These engines walk the grid one row at a time, keeping
+ * only the counts of the current and the next row, and store a count as 64-bit limbs in
+ * separate planes: plane k holds limb k of every column. Each plane is a branch-free loop over
+ * uint64_t lanes that also yields the carries out of its columns, OR-reduced so a row without
+ * overflow costs nothing more. A carry out of the top plane opens a new plane, and the upper
+ * planes are only updated over the columns they can be nonzero in, which is the centre of the
+ * beam cone where the counts are largest. The modular engine keeps one plane and reduces
+ * instead, for deep inputs where the count mod m is all that is needed.
+ *
+ * Beams that would leave the grid sideways are dropped, a beam split onto a splitter next door
+ * keeps its count, and a splitter in the last row is not a timeline. The puzzle inputs never
+ * get there.
+ */
+
+struct WideBeams {
+    int64_t splits{0};
+    std::vector<uint64_t> paths; // little-endian 64-bit limbs
+};
+
+namespace detail {
+
+// Columns [begin, end) of a plane that can be nonzero
+struct Span {
+    size_t begin{0};
+    size_t end{0};
+};
+
+/* One row of counts. Columns are stored with one zero column of padding on either side, so
+ * the row step reads x - 1 and x + 1 without bounds checks and beams leaving the grid land in
+ * the padding, which is never read back.
+ */
+struct Counts {
+    std::vector<std::vector<uint64_t>> planes;
+    std::vector<Span> spans;
+
+    explicit Counts(size_t columns) : planes(1, std::vector<uint64_t>(columns, 0)), spans{{1, columns - 1}} {}
+};
+
+// Splitters of row y as all-ones masks, in padded columns. A Splitter tile is -1, so the
+// arithmetic shift of the tile already is the mask
+inline void splitter_masks(const Input& input, size_t y, std::vector<uint64_t>& masks) {
+    const int64_t* row = input.grid.data() + y * input.width;
+    for (size_t x = 0; x < input.width; ++x) masks[x + 1] = static_cast<uint64_t>(row[x] >> 63);
+}
+
+// Row y + 1 from row y for one plane over [begin, end): what falls straight down, what the
+// splitters either side send over, and the carry from the plane below. Carries out are stored
+// per column (at most 2, three limbs and a carry are added) and their OR is returned so the
+// caller only looks for them when there are any.
+inline uint64_t step_plane(const uint64_t* cur, uint64_t* next, const uint64_t* masks, const uint64_t* carry_in,
+                           uint64_t* carry_out, size_t begin, size_t end) {
+    uint64_t any{0};
+    for (size_t x = begin; x < end; ++x) {
+        const uint64_t down = cur[x] & ~masks[x];
+        const uint64_t from_left = cur[x - 1] & masks[x - 1];
+        const uint64_t from_right = cur[x + 1] & masks[x + 1];
+        const uint64_t a = down + from_left;
+        const uint64_t b = a + from_right;
+        const uint64_t c = b + carry_in[x];
+        const uint64_t carry = uint64_t{a < down} + uint64_t{b < a} + uint64_t{c < b};
+        next[x] = c;
+        carry_out[x] = carry;
+        any |= carry;
+    }
+    return any;
+}
+
+// Adds one beam at padded column x, carrying into the upper planes as far as needed
+inline void add_source(Counts& next, Counts& spare, size_t x) {
+    for (size_t k = 0;; ++k) {
+        if (k == next.planes.size()) {
+            const size_t columns = next.planes[0].size();
+            next.planes.emplace_back(columns, 0);
+            next.spans.push_back({x, x + 1});
+            spare.planes.emplace_back(columns, 0);
+            spare.spans.push_back({x, x + 1});
+        }
+        auto& span = next.spans[k];
+        span = {std::min(span.begin, x), std::max(span.end, x + 1)};
+        if (++next.planes[k][x] != 0) return;
+    }
+}
+
+} // namespace detail
+
+inline WideBeams simulate_wide(const Input& input) {
+    AOC_PHASE("day07/propagation");
+    const size_t columns = input.width + 2;
+    detail::Counts cur{columns}, next{columns};
+    std::vector<uint64_t> masks(columns, 0), live(columns, 0);
+    std::vector<uint64_t> carry_in(columns, 0), carry_out(columns, 0), zeros(columns, 0);
+
+    WideBeams beams;
+    auto sources = [&](size_t y) {
+        const int64_t* row = input.grid.data() + y * input.width;
+        for (size_t x = 0; x < input.width; ++x) {
+            if (row[x] == Tile::Manifold) detail::add_source(next, cur, x + 1);
+        }
+    };
+    sources(0);
+    std::swap(cur, next);
+
+    for (size_t y = 0; y + 1 < input.height; ++y) {
+        detail::splitter_masks(input, y + 1, masks);
+
+        // part 1 needs to know which columns carry any beam, whatever plane its count is in
+        const size_t planes = cur.planes.size();
+        if (planes > 1) {
+            std::ranges::fill(live, 0);
+            for (size_t k = 1; k < planes; ++k) {
+                for (size_t x = cur.spans[k].begin; x < cur.spans[k].end; ++x) live[x] |= cur.planes[k][x];
+            }
+        }
+        int64_t splits{0};
+        const uint64_t* low = cur.planes[0].data();
+        for (size_t x = 1; x + 1 < columns; ++x) splits += static_cast<int64_t>(((low[x] | live[x]) != 0) & masks[x]);
+        beams.splits += splits;
+
+        // the low plane covers the whole row, each plane above the columns its own counts
+        // and the carries from below can reach
+        detail::Span carried{0, 0};
+        for (size_t k = 0; k < planes; ++k) {
+            const detail::Span own = cur.spans[k];
+            detail::Span range{std::max<size_t>(own.begin, 2) - 1, std::min(own.end + 1, columns - 1)};
+            if (carried.begin < carried.end) {
+                range = {std::min(range.begin, carried.begin), std::max(range.end, carried.end)};
+                // carries were only written over the last plane's range
+                std::fill(carry_in.begin() + static_cast<ptrdiff_t>(range.begin), carry_in.begin() + static_cast<ptrdiff_t>(carried.begin), 0);
+                std::fill(carry_in.begin() + static_cast<ptrdiff_t>(carried.end), carry_in.begin() + static_cast<ptrdiff_t>(range.end), 0);
+            }
+            const uint64_t any = detail::step_plane(cur.planes[k].data(), next.planes[k].data(), masks.data(),
+                                                    carried.begin < carried.end ? carry_in.data() : zeros.data(),
+                                                    carry_out.data(), range.begin, range.end);
+            next.spans[k] = range;
+            carried = {0, 0};
+            if (any != 0) {
+                std::swap(carry_in, carry_out);
+                carried = range;
+            }
+        }
+        if (carried.begin < carried.end) {
+            // a carry out of the top plane opens the next one
+            auto& plane = next.planes.emplace_back(columns, 0);
+            std::copy(carry_in.begin() + static_cast<ptrdiff_t>(carried.begin),
+                      carry_in.begin() + static_cast<ptrdiff_t>(carried.end), plane.begin() + static_cast<ptrdiff_t>(carried.begin));
+            next.spans.push_back(carried);
+            cur.planes.emplace_back(columns, 0);
+            cur.spans.push_back(carried);
+        }
+        sources(y + 1);
+        std::swap(cur, next);
+    }
+
+    beams.paths.assign(cur.planes.size() + 1, 0);
+    for (size_t x = 1; x + 1 < columns; ++x) {
+        unsigned __int128 carry{0};
+        for (size_t k = 0; k < cur.planes.size(); ++k) {
+            carry += static_cast<unsigned __int128>(beams.paths[k]) + cur.planes[k][x];
+            beams.paths[k] = static_cast<uint64_t>(carry);
+            carry >>= 64;
+        }
+        beams.paths.back() += static_cast<uint64_t>(carry);
+    }
+    while (beams.paths.size() > 1 && beams.paths.back() == 0) beams.paths.pop_back();
+    return beams;
+}
+
+struct Beams {
+    int64_t splits{0}; // part 1: how often a beam is split
+    int64_t paths{0};  // part 2: how many different paths a beam can take, mod the modulus
+};
+
+// Paths mod modulus with one plane. Moduli up to 2^62 leave room for the three terms of a
+// column before the reduction. A count can be 0 mod the modulus with beams in the column, so
+// part 1 follows which columns carry a beam in a row of all-ones masks of its own, moved like
+// the counts
+inline Beams simulate_mod(const Input& input, uint64_t modulus) {
+    AOC_PHASE("day07/mod");
+    const size_t columns = input.width + 2;
+    std::vector<uint64_t> cur(columns, 0), next(columns, 0), masks(columns, 0);
+    std::vector<uint64_t> live(columns, 0), next_live(columns, 0);
+    auto sources = [&](size_t y, std::vector<uint64_t>& row_counts, std::vector<uint64_t>& row_live) {
+        const int64_t* row = input.grid.data() + y * input.width;
+        for (size_t x = 0; x < input.width; ++x) {
+            if (row[x] == Tile::Manifold) {
+                row_counts[x + 1] = (row_counts[x + 1] + 1) % modulus;
+                row_live[x + 1] = ~uint64_t{0};
+            }
+        }
+    };
+    sources(0, cur, live);
+
+    Beams beams;
+    for (size_t y = 0; y + 1 < input.height; ++y) {
+        detail::splitter_masks(input, y + 1, masks);
+        for (size_t x = 1; x + 1 < columns; ++x) {
+            beams.splits += static_cast<int64_t>(live[x] & masks[x] & 1);
+            uint64_t sum = (cur[x] & ~masks[x]) + (cur[x - 1] & masks[x - 1]) + (cur[x + 1] & masks[x + 1]);
+            sum -= modulus & (0 - uint64_t{sum >= modulus});
+            sum -= modulus & (0 - uint64_t{sum >= modulus});
+            next[x] = sum;
+            next_live[x] = (live[x] & ~masks[x]) | (live[x - 1] & masks[x - 1]) | (live[x + 1] & masks[x + 1]);
+        }
+        sources(y + 1, next, next_live);
+        std::swap(cur, next);
+        std::swap(live, next_live);
+    }
+    uint64_t paths{0};
+    for (size_t x = 1; x + 1 < columns; ++x) paths = (paths + cur[x]) % modulus;
+    beams.paths = static_cast<int64_t>(paths);
+    return beams;
+}
+
+// Decimal digits of a count in 64-bit limbs
+inline std::string to_decimal(std::vector<uint64_t> limbs) {
+    constexpr uint64_t chunk{10'000'000'000'000'000'000u}; // 10^19, the largest power of ten in a limb
+    std::vector<uint64_t> groups; // base 10^19 digits, least significant first
+    while (limbs.size() > 1 || limbs.at(0) >= chunk) {
+        unsigned __int128 remainder{0};
+        for (size_t k = limbs.size(); k-- > 0;) {
+            const unsigned __int128 value = remainder << 64 | limbs[k];
+            limbs[k] = static_cast<uint64_t>(value / chunk);
+            remainder = value % chunk;
+        }
+        groups.push_back(static_cast<uint64_t>(remainder));
+        while (limbs.size() > 1 && limbs.back() == 0) limbs.pop_back();
+    }
+    std::string text = std::format("{}", limbs[0]);
+    for (size_t i = groups.size(); i-- > 0;) text += std::format("{:019}", groups[i]);
+    return text;
+}
+
+/* Beam counts of every row, kept up to date while splitters are added or removed.
+ * A splitter at (y, x) only decides where the beams of row y - 1 over column x go, so an edit
+ * changes columns x - 1 to x + 1 of row y, x - 2 to x + 2 of row y + 1 and so on down a cone.
+ * Only that cone is recomputed, row by row with the plane step of simulate_wide, and the walk
+ * stops at the first row whose recomputed columns equal the cached ones: everything below
+ * follows from them and is already right. Part 1 is kept as a sum of per-row hits, adjusted
+ * over the recomputed columns.
+ *
+ * Memory is the counts of the whole grid, a vector of limb planes per row, so this suits the
+ * interactive sizes rather than the deep generated manifolds.
+ */
+class IncrementalBeams {
+public:
+    explicit IncrementalBeams(const Input& input)
+        : width_{input.width}, height_{input.height}, columns_{input.width + 2},
+          masks_(input.height * columns_, 0), sources_(input.grid.size(), 0), rows_(input.height),
+          carry_in_(columns_, 0), carry_out_(columns_, 0), zeros_(columns_, 0) {
+        AOC_PHASE("day07/incremental-build");
+        for (size_t y = 0; y < height_; ++y) {
+            std::vector<uint64_t> row(columns_, 0);
+            detail::splitter_masks(input, y, row);
+            std::ranges::copy(row, masks_.begin() + static_cast<ptrdiff_t>(y * columns_));
+            for (size_t x = 0; x < width_; ++x) sources_[y * width_ + x] = input.grid[y * width_ + x] == Tile::Manifold;
+        }
+        rows_[0].assign(1, std::vector<uint64_t>(columns_, 0));
+        for (size_t x = 0; x < width_; ++x) {
+            if (sources_[x]) add_one(rows_[0], x + 1);
+        }
+        splits_ = hits(0, 1, columns_ - 1);
+        for (size_t y = 1; y < height_; ++y) recompute(y, 1, columns_ - 1);
+    }
+
+    int64_t splits() const { return splits_; }
+
+    // Timelines as 64-bit limbs, summed over the last row on demand
+    std::vector<uint64_t> paths() const {
+        const auto& planes = rows_[height_ - 1];
+        std::vector<uint64_t> total(planes.size() + 1, 0);
+        for (size_t x = 1; x + 1 < columns_; ++x) {
+            unsigned __int128 carry{0};
+            for (size_t k = 0; k < planes.size(); ++k) {
+                carry += static_cast<unsigned __int128>(total[k]) + planes[k][x];
+                total[k] = static_cast<uint64_t>(carry);
+                carry >>= 64;
+            }
+            total.back() += static_cast<uint64_t>(carry);
+        }
+        while (total.size() > 1 && total.back() == 0) total.pop_back();
+        return total;
+    }
+
+    // Rows the last edit recomputed, for seeing the early stop at work
+    size_t rows_recomputed() const { return rows_recomputed_; }
+
+    /* Adds (present = true) or removes the splitter at row y, column x. The top row holds the
+     * source and cannot be edited, neither can a source cell. Returns whether anything changed.
+     */
+    std::expected<bool, std::string> set_splitter(size_t y, size_t x, bool present) {
+        AOC_PHASE("day07/incremental-edit");
+        if (y == 0 || y >= height_ || x >= width_) {
+            return std::unexpected(std::format("({}, {}) is outside rows 1 to {} and columns 0 to {}", y, x, height_ - 1, width_ - 1));
+        }
+        if (sources_[y * width_ + x]) return std::unexpected(std::format("({}, {}) is a source", y, x));
+        uint64_t& mask = masks_[y * columns_ + x + 1];
+        rows_recomputed_ = 0;
+        if ((mask != 0) == present) return false;
+
+        // the beams of the row above now hit or miss this splitter
+        if (live(y - 1, x + 1)) splits_ += present ? 1 : -1;
+        mask = present ? ~uint64_t{0} : 0;
+
+        for (size_t r = y; r < height_; ++r) {
+            const size_t reach = r - y + 1;
+            const size_t begin = std::max<size_t>(x + 1, reach + 1) - reach;
+            const size_t end = std::min(x + 2 + reach, columns_ - 1);
+            rows_recomputed_++;
+            if (!recompute(r, begin, end)) break;
+        }
+        return true;
+    }
+
+private:
+    const uint64_t* masks(size_t y) const { return masks_.data() + y * columns_; }
+
+    bool live(size_t y, size_t x) const {
+        return std::ranges::any_of(rows_[y], [x](const auto& plane) { return plane[x] != 0; });
+    }
+
+    // beams of row y over splitters of row y + 1 in [begin, end)
+    int64_t hits(size_t y, size_t begin, size_t end) const {
+        if (y + 1 == height_) return 0;
+        int64_t count{0};
+        for (size_t x = begin; x < end; ++x) count += live(y, x) && masks(y + 1)[x] != 0;
+        return count;
+    }
+
+    static void add_one(std::vector<std::vector<uint64_t>>& planes, size_t x) {
+        for (size_t k = 0;; ++k) {
+            if (k == planes.size()) planes.emplace_back(planes[0].size(), 0);
+            if (++planes[k][x] != 0) return;
+        }
+    }
+
+    // Row y over padded columns [begin, end) from row y - 1, into the cache. Returns whether
+    // any count changed
+    bool recompute(size_t y, size_t begin, size_t end) {
+        const auto& above = rows_[y - 1];
+        const size_t planes = above.size();
+        while (scratch_.size() < planes + 1) scratch_.emplace_back(columns_, 0);
+
+        // the plane step of simulate_wide, restricted to the columns that can change
+        size_t computed = planes;
+        bool carried{false};
+        for (size_t k = 0; k < planes; ++k) {
+            const uint64_t any = detail::step_plane(above[k].data(), scratch_[k].data(), masks(y),
+                                                    carried ? carry_in_.data() : zeros_.data(),
+                                                    carry_out_.data(), begin, end);
+            carried = any != 0;
+            if (carried) std::swap(carry_in_, carry_out_);
+        }
+        if (carried) {
+            std::copy(carry_in_.begin() + static_cast<ptrdiff_t>(begin), carry_in_.begin() + static_cast<ptrdiff_t>(end),
+                      scratch_[planes].begin() + static_cast<ptrdiff_t>(begin));
+            computed++;
+        }
+        for (size_t x = begin; x < end; ++x) {
+            if (!sources_[y * width_ + x - 1]) continue;
+            for (size_t k = 0;; ++k) {
+                if (k == computed) {
+                    if (scratch_.size() == computed) scratch_.emplace_back(columns_, 0);
+                    std::fill(scratch_[k].begin() + static_cast<ptrdiff_t>(begin), scratch_[k].begin() + static_cast<ptrdiff_t>(end), 0);
+                    computed++;
+                }
+                if (++scratch_[k][x] != 0) break;
+            }
+        }
+
+        // planes only the cache has are zero in the new counts
+        auto& cached = rows_[y];
+        const size_t levels = std::max(computed, cached.size());
+        auto same = [&](size_t k) {
+            const auto first = static_cast<ptrdiff_t>(begin), last = static_cast<ptrdiff_t>(end);
+            if (k >= cached.size()) return std::all_of(scratch_[k].begin() + first, scratch_[k].begin() + last, [](uint64_t v) { return v == 0; });
+            if (k >= computed) return std::all_of(cached[k].begin() + first, cached[k].begin() + last, [](uint64_t v) { return v == 0; });
+            return std::equal(scratch_[k].begin() + first, scratch_[k].begin() + last, cached[k].begin() + first);
+        };
+        bool unchanged{true};
+        for (size_t k = 0; k < levels && unchanged; ++k) unchanged = same(k);
+        if (unchanged) return false;
+
+        const int64_t before = hits(y, begin, end);
+        while (cached.size() < computed) cached.emplace_back(columns_, 0);
+        for (size_t k = 0; k < cached.size(); ++k) {
+            const auto first = static_cast<ptrdiff_t>(begin), last = static_cast<ptrdiff_t>(end);
+            if (k < computed) {
+                std::copy(scratch_[k].begin() + first, scratch_[k].begin() + last, cached[k].begin() + first);
+            } else {
+                std::fill(cached[k].begin() + first, cached[k].begin() + last, 0);
+            }
+        }
+        splits_ += hits(y, begin, end) - before;
+        return true;
+    }
+
+    size_t width_;
+    size_t height_;
+    size_t columns_;                 // width plus one column of padding either side
+    std::vector<uint64_t> masks_;    // splitter masks per row, padded, see splitter_masks
+    std::vector<uint8_t> sources_;   // 1 where the grid has an 'S'
+    std::vector<std::vector<std::vector<uint64_t>>> rows_; // limb planes of every row, padded
+    std::vector<std::vector<uint64_t>> scratch_;
+    std::vector<uint64_t> carry_in_;
+    std::vector<uint64_t> carry_out_;
+    std::vector<uint64_t> zeros_;
+    int64_t splits_{0};
+    size_t rows_recomputed_{0};
+};
+
+// Both parts come out of one propagation, so it runs while parsing
+inline std::expected<WideBeams, std::string> parse(std::string_view text) {
+    auto input = parse_grid(text);
+    if (!input) return std::unexpected(input.error());
+    return simulate_wide(*input);
+}
+
+inline int64_t part1(const WideBeams& beams) { return beams.splits; }
+
+// Part 2: count how many different paths a beam can take, the low 64 bits where it does not fit
+inline int64_t part2(const WideBeams& beams) { return static_cast<int64_t>(beams.paths[0]); }
+
+} // namespace day07
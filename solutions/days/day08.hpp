@@ -0,0 +1,178 @@
+// Advent of Code Day 8
+// https://adventofcode.com/2025/day/8
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day08 {
+
+struct JBox {
+    int64_t x;
+    int64_t y;
+    int64_t z;
+};
+
+struct Edge {
+    size_t u;
+    size_t v;
+    int64_t dist;
+
+    auto operator<=>(const Edge&) const = default;
+};
+
+// disjoint set union for union find to track circuits 
+// Union-Find maintains partition of elements into disjoint sets (trees)
+// find() uses path compression to flatten the tree for ~O(1) lookup
+// unite() uses union-by-size to attach the smaller tree to the larger one, keeping trees balanced
+struct DSU {
+    std::vector<int> parent;
+    std::vector<int> size;
+
+    DSU(int n) {
+        parent.resize(n);
+        std::iota(parent.begin(), parent.end(), 0);
+        size.assign(n, 1);
+    }
+
+    // returns the root of the set containing i, while applying path compression
+    int find(int i) {
+        if (parent[i] == i)
+            return i;
+        return parent[i] = find(parent[i]);
+    }
+
+    // unites the sets containing i and j using union by size
+    int unite(int i, int j) {
+        i = find(i);
+        j = find(j);
+        if (i != j) {
+            if (size[i] < size[j])
+                std::swap(i, j);
+            parent[j] = i;
+            size[i] += size[j];
+        }
+        return size[i];
+    }
+};
+
+inline int64_t dist(const JBox& p, const JBox& q) {
+    // we just need to compare the distances, so doing the expensive sqrt is actually not necessary,
+    // as its monotonic
+    return (p.x - q.x)*(p.x - q.x) + (p.y - q.y)*(p.y - q.y) + (p.z - q.z)*(p.z - q.z);
+}
+
+// The puzzle connects the 1000 closest pairs, its 20-box example only 10. The count used to be
+// picked by comparing the box count with 1000, which silently used 10 for every generated input.
+inline size_t connection_limit(size_t junction_count) {
+    return junction_count <= 20 ? 10 : 1000;
+}
+
+struct Input {
+    std::vector<JBox> junctions;
+    size_t connections{0}; // closest pairs part 1 connects, connection_limit() unless overridden
+};
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day08/parse");
+    Input input;
+    input.junctions.reserve(aoc::line_count(text));
+    size_t line_number{0};
+    for (std::string_view line : aoc::lines(text)) {
+        line_number++;
+        if (line.empty()) break;
+        std::array<int64_t, 3> xyz;
+        if (auto parsed = aoc::parse_fixed(line, ',', std::span{xyz}); !parsed) {
+            return std::unexpected(std::format("Invalid junction box on line {}: {}", line_number, parsed.error()));
+        }
+        input.junctions.push_back({xyz[0], xyz[1], xyz[2]});
+    }
+    input.connections = connection_limit(input.junctions.size());
+    return input;
+}
+
+// all pairs of junction boxes, closest first
+inline std::vector<Edge> sorted_edges(const std::vector<JBox>& junctions) {
+    AOC_PHASE("day08/edges");
+    // generate all edges
+    std::vector<Edge> edges;
+    // pre-calculate size: N * (N-1) / 2
+    size_t n = junctions.size();
+    edges.reserve(n * (n - 1) / 2);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = i + 1; j < n; j++) {
+            edges.push_back({i, j, dist(junctions[i], junctions[j])});
+        }
+    }
+
+    // sort by distance
+    AOC_PHASE_NEXT("day08/sort");
+    std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+        return a.dist < b.dist;
+    });
+    return edges;
+}
+
+// sizes of the circuits after connecting the limit closest pairs, largest first
+inline std::vector<int64_t> circuit_sizes(size_t n, const std::vector<Edge>& edges, size_t limit) {
+    AOC_PHASE("day08/union");
+    DSU dsu(static_cast<int>(n));
+    for (size_t i = 0; i < std::min(limit, edges.size()); i++) {
+        dsu.unite(edges[i].u, edges[i].v);
+    }
+
+    std::vector<int64_t> sizes;
+    sizes.reserve(n);
+    for (int i = 0; i < static_cast<int>(n); ++i) {
+        // Since we tracked size in the root, we only take sizes from root nodes
+        if (dsu.parent[i] == i) {
+            sizes.push_back(dsu.size[i]);
+        }
+    }
+
+    // Sort descending to find largest clusters
+    std::sort(sizes.rbegin(), sizes.rend());
+    return sizes;
+}
+
+// the pair whose connection leaves a single circuit
+inline std::optional<Edge> last_connection(size_t n, const std::vector<Edge>& edges) {
+    AOC_PHASE("day08/union");
+    DSU dsu(static_cast<int>(n));
+    for (const Edge& edge : edges) {
+        if (static_cast<size_t>(dsu.unite(edge.u, edge.v)) == n) return edge;
+    }
+    return std::nullopt;
+}
+
+inline int64_t part1(const Input& input) {
+    AOC_PHASE("day08/part1");
+    const size_t n = input.junctions.size();
+    const auto sizes = circuit_sizes(n, sorted_edges(input.junctions), input.connections);
+    int64_t result{1};
+    for (size_t i = 0; i < std::min<size_t>(3, sizes.size()); i++) result *= sizes[i];
+    return result;
+}
+
+// part 2: connect until there is only one set. return multiplication of x-coords of the last two connected ones
+inline int64_t part2(const Input& input) {
+    AOC_PHASE("day08/part2");
+    const auto last = last_connection(input.junctions.size(), sorted_edges(input.junctions));
+    return last ? input.junctions[last->u].x * input.junctions[last->v].x : 0;
+}
+
+} // namespace day08
@@ -0,0 +1,347 @@
+// Advent of Code Day 9
+// https://adventofcode.com/2025/day/9
+
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <array>
+#include <span>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <queue>
+#include <thread>
+#include <optional>
+#include <functional>
+#include <atomic>
+#include <limits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day09 {
+
+struct Tile {
+    int64_t x;
+    int64_t y;
+};
+
+struct Box {
+    int64_t x, y, u, v; // min_x, min_y, max_x, max_y
+
+    // construct normalized box from two points
+    static Box from(Tile p1, Tile p2) {
+        return {
+            std::min(p1.x, p2.x), std::min(p1.y, p2.y),
+            std::max(p1.x, p2.x), std::max(p1.y, p2.y)
+        };
+    }
+
+    int64_t area() const { 
+        return (u - x + 1) * (v - y + 1); 
+    }
+};
+
+// true if any polygon edge cuts into the interior of rect
+inline bool overlaps_any(const Box& rect, const std::vector<Box>& lines) {
+    for (const auto& line : lines) {
+        if (line.x < rect.u && line.y < rect.v && line.u > rect.x && line.v > rect.y) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Polygon edges as structure-of-arrays for the vectorized overlap scan.
+// Padded to a multiple of the lane count with edges that can never overlap.
+struct EdgeSoA {
+    static constexpr size_t lanes = 4;
+    std::vector<int64_t> x, y, u, v;
+
+    explicit EdgeSoA(const std::vector<Box>& lines) {
+        const size_t padded = (lines.size() + lanes - 1) / lanes * lanes;
+        x.assign(padded, std::numeric_limits<int64_t>::max());
+        y.assign(padded, std::numeric_limits<int64_t>::max());
+        u.assign(padded, std::numeric_limits<int64_t>::min());
+        v.assign(padded, std::numeric_limits<int64_t>::min());
+        for (size_t i = 0; i < lines.size(); ++i) {
+            x[i] = lines[i].x;
+            y[i] = lines[i].y;
+            u[i] = lines[i].u;
+            v[i] = lines[i].v;
+        }
+    }
+
+    size_t size() const { return x.size(); }
+};
+
+// Same test as above on the SoA layout. With AVX2 (-mavx2 / -march=native) four edges
+// are compared per iteration, the four conditions are and-ed into one mask and the
+// scan exits on the first block with a hit.
+inline bool overlaps_any(const Box& rect, const EdgeSoA& edges) {
+#if defined(__AVX2__)
+    const __m256i ru = _mm256_set1_epi64x(rect.u);
+    const __m256i rv = _mm256_set1_epi64x(rect.v);
+    const __m256i rx = _mm256_set1_epi64x(rect.x);
+    const __m256i ry = _mm256_set1_epi64x(rect.y);
+    for (size_t i = 0; i < edges.size(); i += EdgeSoA::lanes) {
+        const auto load = [i](const std::vector<int64_t>& a) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data() + i));
+        };
+        __m256i hit = _mm256_and_si256(_mm256_cmpgt_epi64(ru, load(edges.x)),
+                                       _mm256_cmpgt_epi64(rv, load(edges.y)));
+        hit = _mm256_and_si256(hit, _mm256_cmpgt_epi64(load(edges.u), rx));
+        hit = _mm256_and_si256(hit, _mm256_cmpgt_epi64(load(edges.v), ry));
+        if (_mm256_movemask_epi8(hit) != 0) return true;
+    }
+    return false;
+#else
+    for (size_t i = 0; i < edges.size(); i += EdgeSoA::lanes) {
+        bool hit = false;
+        for (size_t k = i; k < i + EdgeSoA::lanes; ++k) {
+            hit |= edges.x[k] < rect.u && edges.y[k] < rect.v && edges.u[k] > rect.x && edges.v[k] > rect.y;
+        }
+        if (hit) return true;
+    }
+    return false;
+#endif
+}
+
+inline unsigned worker_count() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Part 1 without storing pairs: every thread takes a strided set of rows of the
+// upper triangle (so the short and long rows are spread evenly) and keeps a local max
+inline int64_t max_area_parallel(const std::vector<Tile>& tiles) {
+    const size_t n = tiles.size();
+    const unsigned threads = worker_count();
+    std::vector<int64_t> local(threads, 0);
+    {
+        std::vector<std::jthread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                int64_t best{0};
+                for (size_t i = t; i < n; i += threads) {
+                    for (size_t j = i + 1; j < n; ++j) {
+                        best = std::max(best, Box::from(tiles[i], tiles[j]).area());
+                    }
+                }
+                local[t] = best;
+            });
+        }
+    }
+    return *std::max_element(local.begin(), local.end());
+}
+
+/* Part 1 in O(n log n) via the extreme staircases of the point set.
+ * For a rectangle spanned from lower-left p to upper-right q, p can always be moved to a
+ * point that is minimal in both coordinates and q to one that is maximal, without losing
+ * area. So only pairs between the lower-left and the upper-right staircase matter (and the
+ * same again with y mirrored for the other diagonal). Both staircases are sorted by x
+ * ascending / y descending, on which f(i, j) = (qx - px + 1) * (qy - py + 1) satisfies
+ * f(i, j) + f(i', j') >= f(i, j') + f(i', j) for i < i', j < j'. The best q for each p is
+ * therefore monotone and divide and conquer finds all of them in O(h log h).
+ * A q strictly below-left of p would make both factors negative, but that would contradict
+ * p being minimal, so every positive f is a real rectangle.
+ */
+inline std::vector<Tile> lower_left_staircase(std::vector<Tile> pts) {
+    std::sort(pts.begin(), pts.end(), [](const Tile& a, const Tile& b) {
+        return a.x != b.x ? a.x < b.x : a.y < b.y;
+    });
+    std::vector<Tile> stair;
+    for (const auto& p : pts) {
+        if (stair.empty() || p.y < stair.back().y) stair.push_back(p);
+    }
+    return stair;
+}
+
+inline std::vector<Tile> upper_right_staircase(std::vector<Tile> pts) {
+    std::sort(pts.begin(), pts.end(), [](const Tile& a, const Tile& b) {
+        return a.x != b.x ? a.x > b.x : a.y > b.y;
+    });
+    std::vector<Tile> stair;
+    for (const auto& p : pts) {
+        if (stair.empty() || p.y > stair.back().y) stair.push_back(p);
+    }
+    std::reverse(stair.begin(), stair.end());
+    return stair;
+}
+
+inline int64_t max_area_staircase(const std::vector<Tile>& lower, const std::vector<Tile>& upper) {
+    auto f = [&](size_t i, size_t j) {
+        return (upper[j].x - lower[i].x + 1) * (upper[j].y - lower[i].y + 1);
+    };
+
+    int64_t best{0};
+    // rows [lo, hi) have their optimum within columns [opt_lo, opt_hi]
+    auto solve = [&](auto&& self, size_t lo, size_t hi, size_t opt_lo, size_t opt_hi) -> void {
+        if (lo >= hi) return;
+        const size_t mid = lo + (hi - lo) / 2;
+        size_t opt = opt_lo;
+        int64_t mid_best = f(mid, opt_lo);
+        for (size_t j = opt_lo + 1; j <= opt_hi; ++j) {
+            // take the last argmax so ties stay monotone
+            if (int64_t v = f(mid, j); v >= mid_best) {
+                mid_best = v;
+                opt = j;
+            }
+        }
+        best = std::max(best, mid_best);
+        self(self, lo, mid, opt_lo, opt);
+        self(self, mid + 1, hi, opt, opt_hi);
+    };
+    solve(solve, 0, lower.size(), 0, upper.size() - 1);
+    return best;
+}
+
+inline int64_t max_area_hull(const std::vector<Tile>& tiles) {
+    if (tiles.size() < 2) return 0;
+    int64_t best = max_area_staircase(lower_left_staircase(tiles), upper_right_staircase(tiles));
+
+    // other diagonal: upper-left to lower-right is the same problem with y mirrored
+    std::vector<Tile> mirrored(tiles);
+    for (auto& t : mirrored) t.y = -t.y;
+    return std::max(best, max_area_staircase(lower_left_staircase(mirrored), upper_right_staircase(mirrored)));
+}
+
+// (area, i, j) gives a strict total order over all pairs, so a batch boundary
+// never splits a group of equal areas in an ambiguous way
+struct Candidate {
+    int64_t area;
+    uint32_t i;
+    uint32_t j;
+    auto operator<=>(const Candidate&) const = default;
+};
+
+/* Part 2 best-first in bounded batches. Each pass streams over all pairs below the
+ * previous batch and keeps only the `batch` largest in per-thread min-heaps, then the
+ * merged batch is checked in descending order. The first rectangle without an overlap
+ * is the answer, and if none in the batch is valid, the next pass continues strictly
+ * below its smallest key. Memory is O(n + threads * batch) instead of O(n^2).
+ * The batch itself is validated by all threads at once, see below.
+ */
+inline std::optional<int64_t> largest_valid_area(const std::vector<Tile>& tiles, const EdgeSoA& edges,
+                                          size_t batch = 1 << 14) {
+    const size_t n = tiles.size();
+    const unsigned threads = worker_count();
+    using MinHeap = std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>>;
+
+    std::optional<Candidate> bound{};
+    std::vector<MinHeap> heaps(threads);
+    std::vector<Candidate> merged;
+
+    while (true) {
+        {
+            std::vector<std::jthread> pool;
+            for (unsigned t = 0; t < threads; ++t) {
+                pool.emplace_back([&, t] {
+                    MinHeap& heap = heaps[t];
+                    for (size_t i = t; i < n; i += threads) {
+                        for (size_t j = i + 1; j < n; ++j) {
+                            Candidate c{Box::from(tiles[i], tiles[j]).area(),
+                                        static_cast<uint32_t>(i), static_cast<uint32_t>(j)};
+                            if (bound && !(c < *bound)) continue;
+                            if (heap.size() < batch) {
+                                heap.push(c);
+                            } else if (heap.top() < c) {
+                                heap.pop();
+                                heap.push(c);
+                            }
+                        }
+                    }
+                });
+            }
+        }
+
+        merged.clear();
+        for (auto& heap : heaps) {
+            while (!heap.empty()) {
+                merged.push_back(heap.top());
+                heap.pop();
+            }
+        }
+        if (merged.empty()) return std::nullopt;
+
+        std::sort(merged.begin(), merged.end(), std::greater<>{});
+        // only the global top `batch` are certain to be the next largest of all pairs
+        if (merged.size() > batch) merged.resize(batch);
+
+        // threads claim candidates in descending order and publish the best valid area;
+        // once a claimed candidate is not larger than it, nothing after it can win either
+        std::atomic<size_t> next{0};
+        std::atomic<int64_t> best{-1};
+        {
+            std::vector<std::jthread> pool;
+            for (unsigned t = 0; t < threads; ++t) {
+                pool.emplace_back([&] {
+                    for (size_t k = next++; k < merged.size(); k = next++) {
+                        const Candidate& c = merged[k];
+                        if (c.area <= best.load(std::memory_order_relaxed)) break;
+                        if (overlaps_any(Box::from(tiles[c.i], tiles[c.j]), edges)) continue;
+
+                        int64_t seen = best.load(std::memory_order_relaxed);
+                        while (seen < c.area && !best.compare_exchange_weak(seen, c.area)) {}
+                        break;
+                    }
+                });
+            }
+        }
+        if (best >= 0) return best.load();
+        bound = merged.back();
+    }
+}
+
+struct Input {
+    std::vector<Tile> tiles;
+    std::vector<Box> lines; // edges between consecutive red tiles, wrapping around
+};
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day09/parse");
+    Input input;
+    auto& tiles = input.tiles;
+    tiles.reserve(aoc::line_count(text));
+
+    // read all tiles
+    size_t line_number{0};
+    for (std::string_view line : aoc::lines(text)) {
+        line_number++;
+        if (line.empty()) continue;
+        std::array<int64_t, 2> xy;
+        if (auto parsed = aoc::parse_fixed(line, ',', std::span{xy}); !parsed) {
+            return std::unexpected(std::format("Invalid tile on line {}: {}", line_number, parsed.error()));
+        }
+        tiles.push_back({xy[0], xy[1]});
+    }
+
+    // generate lines (pairwise in order + wrap around) as Boxes
+    const size_t n = tiles.size();
+    for (size_t i = 0; i < n; ++i) {
+        input.lines.push_back(Box::from(tiles[i], tiles[(i + 1) % n]));
+    }
+    return input;
+}
+
+inline int64_t part1(const Input& input) {
+    AOC_PHASE("day09/part1");
+    return max_area_hull(input.tiles);
+}
+
+// Part 2: largest rectangle that does not overlap with any line's bounding box, 0 if none
+inline int64_t part2(const Input& input) {
+    AOC_PHASE("day09/part2");
+    if (input.tiles.empty()) return 0;
+    return largest_valid_area(input.tiles, EdgeSoA{input.lines}).value_or(0);
+}
+
+} // namespace day09
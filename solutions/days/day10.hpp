@@ -0,0 +1,1258 @@
+// Advent of Code Day 10
+// https://adventofcode.com/2025/day/10
+
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <ranges>
+#include <array>
+#include <vector>
+#include <cstdlib>
+#include <charconv>
+#include <numeric>
+#include <algorithm>
+#include <deque>
+#include <cmath>
+#include <random>
+#include <functional>
+#include <bit>
+#include <optional>
+#include <unordered_map>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <queue>
+#include <atomic>
+#include <condition_variable>
+#include <format>
+#include <print>
+#include <span>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "../aoc/input.hpp"
+#include "../aoc/parse.hpp"
+#include "../aoc/probe.hpp"
+
+namespace day10 {
+
+// A manual is a view into the pools of its ManualFile. The buttons are stored in
+// compressed-sparse-row form: button b covers indices[offsets[b], offsets[b + 1]).
+struct Manual {
+    uint64_t lights; // target bitmask
+    int16_t len;     // num lights (at most 64)
+    uint32_t line;   // line in the input file, for diagnostics
+    std::span<const uint32_t> offsets; // button count + 1 entries, offsets[0] == 0
+    std::span<const int16_t> indices;
+    std::span<const int64_t> joltages;
+
+    size_t button_count() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    std::span<const int16_t> button(size_t b) const {
+        return indices.subspan(offsets[b], offsets[b + 1] - offsets[b]);
+    }
+
+    auto buttons() const {
+        return std::views::iota(size_t{0}, button_count())
+             | std::views::transform([this](size_t b) { return button(b); });
+    }
+};
+
+// All manuals of an input file share one index, offset and joltage pool. A counting pass
+// sizes them exactly, so they come out of a single arena block: parsing allocates a constant
+// number of times per file instead of a few vectors per button.
+struct ManualFile {
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::vector<Manual> manuals{&arena};
+    std::pmr::vector<uint32_t> offsets{&arena};
+    std::pmr::vector<int16_t> indices{&arena};
+    std::pmr::vector<int64_t> joltages{&arena};
+
+    explicit ManualFile(size_t arena_bytes) : arena(arena_bytes, aoc::probe::memory_resource()) {}
+};
+
+// The manuals only point into the pools, so the text may go away once parsing is done
+using Input = std::unique_ptr<ManualFile>;
+
+inline std::expected<Input, std::string> parse(std::string_view text) {
+    AOC_PHASE("day10/parse");
+    // counting pass: a list with k commas holds k + 1 numbers
+    size_t manuals{0}, buttons{0}, indices{0}, joltages{0};
+    bool in_line{false};
+    char group{0};
+    for (char c : text) {
+        if (c == '\n') {
+            in_line = false;
+            continue;
+        }
+        if (!in_line && c != '\r') {
+            in_line = true;
+            manuals++;
+        }
+        if (c == '(' || c == '{') {
+            group = c;
+            if (c == '(') {
+                buttons++;
+                indices++;
+            } else {
+                joltages++;
+            }
+        } else if (c == ',' && group != 0) {
+            (group == '(' ? indices : joltages)++;
+        } else if (c == ')' || c == '}') {
+            group = 0;
+        }
+    }
+    const size_t bytes = manuals * sizeof(Manual) + (buttons + manuals) * sizeof(uint32_t)
+                       + indices * sizeof(int16_t) + joltages * sizeof(int64_t)
+                       + 4 * alignof(std::max_align_t);
+
+    auto file = std::make_unique<ManualFile>(bytes);
+    file->manuals.reserve(manuals);
+    file->offsets.reserve(buttons + manuals);
+    file->indices.reserve(indices);
+    file->joltages.reserve(joltages);
+
+    // Helper to parse comma-separated lists "(1,2,3)" or "{1,2,3}" straight into a pool
+    auto parse_group = []<typename T>(std::string_view sv, char open, char close,
+                                      std::pmr::vector<T>& pool) -> std::expected<size_t, std::string> {
+        if (sv.size() < 2 || sv.front() != open || sv.back() != close) {
+            return std::unexpected(std::format("expected {}...{}", open, close));
+        }
+        return aoc::parse_list(sv.substr(1, sv.size() - 2), ',', pool);
+    };
+
+    // Where each manual starts in the offset, index and joltage pools. The spans are only taken
+    // once every manual is in: a line the counting pass misjudged would grow a pool past its
+    // reserve, and a span taken before that would point into the old block.
+    std::vector<std::array<size_t, 3>> starts;
+    starts.reserve(manuals + 1);
+
+    size_t line_number{0};
+    for (std::string_view line : aoc::lines(text)) {
+        line_number++;
+        if (line.empty()) continue;
+
+        auto pos = line.find(' ');
+        if (line.front() != '[' || pos == std::string_view::npos || pos < 2) {
+            return std::unexpected(std::format("Line {}: expected [lights] at the start", line_number));
+        }
+
+        Manual man{};
+        man.line = static_cast<uint32_t>(line_number);
+        constexpr char on{'#'};
+
+        // Parse lights into bitmask for Part 1
+        man.lights = 0;
+        man.len = static_cast<int16_t>(std::min<size_t>(pos - 2, 65));
+        if (man.len > 64) {
+            return std::unexpected(std::format("Line {}: too many lights, at most 64 are supported", line_number));
+        }
+        for (size_t i = 1; i < pos - 1; i++) {
+            if (line[i] == on) {
+                man.lights = man.lights | (uint64_t{1} << (man.len - i));
+            }
+        }
+
+        const size_t first_index = file->indices.size();
+        starts.push_back({file->offsets.size(), first_index, file->joltages.size()});
+        file->offsets.push_back(0);
+
+        auto prev_pos = pos + 1;
+        pos = line.find(' ', prev_pos);
+
+        // Parse buttons: (1,3) (2) ...
+        while (pos != std::string_view::npos) {
+            std::string_view chunk = line.substr(prev_pos, pos - prev_pos);
+            if (auto parsed = parse_group(chunk, '(', ')', file->indices); !parsed) {
+                return std::unexpected(std::format("Line {}: invalid button {}: {}", line_number, chunk, parsed.error()));
+            }
+            file->offsets.push_back(static_cast<uint32_t>(file->indices.size() - first_index));
+
+            prev_pos = pos + 1;
+            pos = line.find(' ', prev_pos);
+        }
+
+        // Parse joltages: {3,5,4,7}
+        std::string_view last = line.substr(prev_pos);
+        if (auto parsed = parse_group(last, '{', '}', file->joltages); !parsed) {
+            return std::unexpected(std::format("Line {}: invalid joltages {}: {}", line_number, last, parsed.error()));
+        }
+
+        if (file->offsets.size() - starts.back()[0] > 65) {
+            return std::unexpected(std::format("Line {}: too many buttons, at most 64 are supported", line_number));
+        }
+        file->manuals.push_back(man);
+    }
+
+    starts.push_back({file->offsets.size(), file->indices.size(), file->joltages.size()});
+    for (size_t m = 0; m < file->manuals.size(); m++) {
+        const auto& [offset, index, joltage] = starts[m];
+        const auto& next = starts[m + 1];
+        file->manuals[m].offsets = std::span{file->offsets}.subspan(offset, next[0] - offset);
+        file->manuals[m].indices = std::span{file->indices}.subspan(index, next[1] - index);
+        file->manuals[m].joltages = std::span{file->joltages}.subspan(joltage, next[2] - joltage);
+    }
+    return file;
+}
+
+inline std::string getBinaryRep(uint64_t n, int len) {
+    std::string ans = "";
+    for (int i = len - 1; i >= 0; i--) {
+        // If i'th bit is set 
+        if (n & (uint64_t{1} << i)) ans += '1';
+        else ans += '0';
+    }
+    return ans;
+}
+
+// Button masks in the same bit order as Manual::lights, built once per manual
+inline void button_masks(const Manual& m, std::vector<uint64_t>& masks) {
+    masks.clear();
+    for (const auto btn : m.buttons()) {
+        uint64_t mask{0};
+        for (int idx : btn) {
+            if (idx >= 0 && idx < m.len) mask |= uint64_t{1} << (m.len - idx - 1);
+        }
+        masks.push_back(mask);
+    }
+}
+
+/* Solve Part 1 as linear algebra over GF(2).
+ * Pressing a button twice cancels out, so every button is pressed 0 or 1 times and we look
+ * for the minimum-weight x with XOR of x_i * mask_i == lights. Gaussian elimination gives a
+ * particular solution plus a null space basis (one vector per free button). If the null
+ * space is small it is enumerated in Gray code order, otherwise meet-in-the-middle over the
+ * two halves of the buttons is cheaper. Either way the cost is at most ~2^(buttons / 2),
+ * independent of the number of lights. The meet-in-the-middle table holds one entry per
+ * distinct XOR of first-half buttons, at most 2^min(buttons / 2, rank); past 2^24 entries
+ * the Gray code walk runs instead, slower but in constant memory. Returns nullopt if the
+ * lights cannot be reached.
+ */
+inline std::optional<int32_t> min_presses_gf2(const std::vector<uint64_t>& masks, uint64_t target, int len) {
+    AOC_PHASE("day10/gf2");
+    const int vars = static_cast<int>(masks.size());
+    if (target == 0) return 0;
+    if (vars == 0) return std::nullopt;
+
+    // one equation per light: row bit b set if button b toggles that light
+    // (at most 64 lights and buttons, so everything fits on the stack)
+    std::array<uint64_t, 64> rows{};
+    std::array<uint8_t, 64> rhs{};
+    for (int k = 0; k < len; ++k) {
+        for (int b = 0; b < vars; ++b) {
+            if ((masks[b] >> k) & 1) rows[k] |= uint64_t{1} << b;
+        }
+        rhs[k] = (target >> k) & 1;
+    }
+
+    // reduced row echelon form
+    std::array<int, 64> pivot_col{};
+    int rank{0};
+    for (int col = 0; col < vars && rank < len; ++col) {
+        const uint64_t bit = uint64_t{1} << col;
+        int r = rank;
+        while (r < len && !(rows[r] & bit)) ++r;
+        if (r == len) continue;
+        std::swap(rows[r], rows[rank]);
+        std::swap(rhs[r], rhs[rank]);
+        for (int i = 0; i < len; ++i) {
+            if (i != rank && (rows[i] & bit)) {
+                rows[i] ^= rows[rank];
+                rhs[i] ^= rhs[rank];
+            }
+        }
+        pivot_col[rank++] = col;
+    }
+    for (int i = rank; i < len; ++i) {
+        if (rhs[i]) return std::nullopt; // 0 = 1
+    }
+
+    constexpr int table_bits_limit = 24;
+    const int free_count = vars - rank;
+    const int half = vars / 2;
+    const int table_bits = std::min(half, rank);
+    if (free_count <= (vars + 1) / 2 || table_bits > table_bits_limit) {
+        uint64_t x{0};
+        for (int i = 0; i < rank; ++i) {
+            if (rhs[i]) x |= uint64_t{1} << pivot_col[i];
+        }
+        std::array<uint64_t, 64> basis{};
+        size_t basis_size{0};
+        uint64_t pivots{0};
+        for (int i = 0; i < rank; ++i) pivots |= uint64_t{1} << pivot_col[i];
+        for (int c = 0; c < vars; ++c) {
+            if (pivots & (uint64_t{1} << c)) continue;
+            uint64_t v = uint64_t{1} << c;
+            for (int i = 0; i < rank; ++i) {
+                if (rows[i] & (uint64_t{1} << c)) v |= uint64_t{1} << pivot_col[i];
+            }
+            basis[basis_size++] = v;
+        }
+
+        int32_t best = std::popcount(x);
+        for (uint64_t g = 1; g < (uint64_t{1} << free_count); ++g) {
+            x ^= basis[std::countr_zero(g)];
+            best = std::min(best, static_cast<int32_t>(std::popcount(x)));
+        }
+        return best;
+    }
+
+    // meet in the middle: cheapest XOR of each first-half subset, matched against the second half
+    std::unordered_map<uint64_t, int32_t> left;
+    left.reserve(size_t{1} << table_bits);
+    uint64_t acc{0};
+    left.emplace(0, 0);
+    for (uint64_t g = 1; g < (uint64_t{1} << half); ++g) {
+        acc ^= masks[std::countr_zero(g)];
+        const int32_t w = std::popcount(g ^ (g >> 1));
+        auto [it, inserted] = left.try_emplace(acc, w);
+        if (!inserted) it->second = std::min(it->second, w);
+    }
+
+    std::optional<int32_t> best{};
+    acc = 0;
+    for (uint64_t g = 0; g < (uint64_t{1} << (vars - half)); ++g) {
+        if (g != 0) acc ^= masks[half + std::countr_zero(g)];
+        if (auto it = left.find(target ^ acc); it != left.end()) {
+            const int32_t w = it->second + std::popcount(g ^ (g >> 1));
+            if (!best || w < *best) best = w;
+        }
+    }
+    return best;
+}
+
+// Part 1: BFS with XOR (original engine, at most 16 lights)
+inline std::optional<int32_t> min_presses_bfs(const Manual& man) {
+    if (man.lights == 0) return 0; // Part 1 only cares about getting lights to 0
+    AOC_PHASE("day10/bfs");
+
+    std::vector<bool> visited(65536, false);
+    std::deque<uint16_t> q;
+    
+    q.push_back(0);
+    visited[0] = true;
+
+    int16_t presses{0};
+
+    while (!q.empty()) {
+        presses++;
+        size_t in_q = q.size();
+        while (in_q--) {
+            uint16_t curr = q.front();
+            q.pop_front();
+
+            for (const auto btn_indices : man.buttons()) {
+                // Convert Indices back to Mask
+                uint16_t btn_mask = 0;
+                for (int idx : btn_indices) {
+                    if (idx < man.len) // Safety check
+                        btn_mask |= (1 << (man.len - idx - 1));
+                }
+
+                uint16_t next_state = curr ^ btn_mask;
+                if (next_state == man.lights) return presses;
+
+                if (!visited[next_state]) {
+                    visited[next_state] = true;
+                    q.push_back(next_state);
+                }
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+/* Bounded-variable dual simplex for  min sum x  s.t.  A x = joltages,  lower <= x <= upper.
+ * Everything lives in one row-major tableau of (rows + 1) x (cols + 1) doubles:
+ * rows 0..rows-1 hold B^-1 [A | I], row `rows` the reduced costs, the last column B^-1 b.
+ * The identity columns are one artificial per counter, fixed to [0, 0].
+ * Every structural variable gets a finite upper bound (the smallest joltage it feeds), so a
+ * basis can always be made dual feasible by parking each nonbasic variable at the bound that
+ * matches the sign of its reduced cost. The all-artificial start basis is dual feasible
+ * as-is (all costs are 1), so the root and every branch-and-bound node are solved by the
+ * same dual simplex, warm-started from wherever the previous node left the tableau.
+ */
+struct DualSimplex {
+    static constexpr double EPS = 1e-9;
+    enum Status : int8_t { Basic, AtLower, AtUpper };
+
+    int rows{0};
+    int vars{0};
+    int cols{0};   // vars + rows (artificials)
+    int stride{1}; // cols + 1
+    std::vector<double> T;
+    std::vector<double> lower, upper, x;
+    std::vector<int> basis;
+    std::vector<Status> status;
+    bool stalled{false}; // some solve() since load() gave up at the iteration cap
+
+    // (Re)initialize for a manual. Buffers keep their capacity, so a reused instance
+    // stops allocating once it has seen the largest manual.
+    void load(const Manual& m) {
+        rows = static_cast<int>(m.joltages.size());
+        vars = static_cast<int>(m.button_count());
+        cols = vars + rows;
+        stride = cols + 1;
+        T.assign(static_cast<size_t>(rows + 1) * stride, 0.0);
+        lower.assign(cols, 0.0);
+        upper.assign(cols, 0.0);
+        x.assign(cols, 0.0);
+        basis.assign(rows, 0);
+        status.assign(cols, AtLower);
+        stalled = false;
+        for (int j = 0; j < vars; ++j) {
+            upper[j] = std::numeric_limits<double>::infinity();
+            for (int idx : m.button(j)) {
+                if (idx < 0 || idx >= rows) continue;
+                at(idx, j) += 1.0;
+                upper[j] = std::min(upper[j], static_cast<double>(m.joltages[idx]));
+            }
+            if (upper[j] == std::numeric_limits<double>::infinity()) upper[j] = 0.0; // feeds nothing
+            at(rows, j) = 1.0; // cost
+        }
+        for (int i = 0; i < rows; ++i) {
+            at(i, vars + i) = 1.0;
+            at(i, cols) = static_cast<double>(m.joltages[i]);
+            basis[i] = vars + i;
+            status[vars + i] = Basic;
+        }
+        update_basic_values();
+    }
+
+    double& at(int r, int c) { return T[static_cast<size_t>(r) * stride + c]; }
+
+    // Change the bounds of a variable. Nonbasic variables are re-parked on the side their
+    // reduced cost prefers, which keeps the tableau dual feasible for the next solve().
+    void set_bounds(int j, double lo, double hi) {
+        lower[j] = lo;
+        upper[j] = hi;
+        if (status[j] != Basic) {
+            status[j] = (at(rows, j) < 0.0 && lo < hi) ? AtUpper : AtLower;
+            x[j] = (status[j] == AtUpper) ? hi : lo;
+        }
+    }
+
+    // x_B = B^-1 b - B^-1 N x_N, recomputed from the tableau to avoid drift
+    void update_basic_values() {
+        for (int i = 0; i < rows; ++i) {
+            double v = at(i, cols);
+            for (int j = 0; j < cols; ++j) {
+                if (status[j] != Basic && x[j] != 0.0) v -= at(i, j) * x[j];
+            }
+            x[basis[i]] = v;
+        }
+    }
+
+    void pivot(int r, int q) {
+        const double inv = 1.0 / at(r, q);
+        double* pr = &T[static_cast<size_t>(r) * stride];
+        for (int j = 0; j <= cols; ++j) pr[j] *= inv;
+        for (int i = 0; i <= rows; ++i) {
+            if (i == r) continue;
+            double* pi = &T[static_cast<size_t>(i) * stride];
+            const double f = pi[q];
+            if (f == 0.0) continue;
+            for (int j = 0; j <= cols; ++j) pi[j] -= f * pr[j];
+        }
+    }
+
+    // Reoptimize from the current (dual feasible) basis. Returns false if infeasible, or if
+    // the iteration cap is reached, which also sets `stalled`.
+    bool solve() {
+        AOC_PHASE("day10/simplex");
+        update_basic_values();
+        // Bland's rule against cycling: smallest index for the leaving row and, among the
+        // tied ratios, for the entering column. It cannot cycle, the cap is only a backstop
+        // against numerical trouble.
+        const int bland_after = 50 * (rows + cols);
+        const int max_iterations = 2 * bland_after + 1000;
+        for (int iter = 0;; ++iter) {
+            if (iter == max_iterations) {
+                stalled = true;
+                return false;
+            }
+            // leaving row: the most violated basic variable
+            int r = -1;
+            double worst = EPS;
+            for (int i = 0; i < rows; ++i) {
+                const int b = basis[i];
+                const double viol = std::max(lower[b] - x[b], x[b] - upper[b]);
+                if (viol > worst && (iter < bland_after || r == -1 || b < basis[r])) {
+                    worst = (iter < bland_after) ? viol : EPS;
+                    r = i;
+                }
+            }
+            if (r == -1) return true;
+
+            const int leaving = basis[r];
+            const bool to_lower = x[leaving] < lower[leaving];
+
+            // entering column: dual ratio test over nonbasic columns that move x_B[r] the right way
+            int q = -1;
+            double best_ratio = 0.0;
+            for (int j = 0; j < cols; ++j) {
+                if (status[j] == Basic || lower[j] == upper[j]) continue;
+                const double alpha = at(r, j);
+                if (std::abs(alpha) <= EPS) continue;
+                const bool increases = (status[j] == AtLower) ? alpha < 0.0 : alpha > 0.0;
+                if (increases != to_lower) continue;
+                const double ratio = std::abs(at(rows, j) / alpha);
+                // columns run in index order, so under Bland's rule a tie keeps the first
+                if (q == -1 || ratio < best_ratio - EPS ||
+                    (iter < bland_after && ratio <= best_ratio + EPS && std::abs(alpha) > std::abs(at(r, q)))) {
+                    q = j;
+                    best_ratio = ratio;
+                }
+            }
+            if (q == -1) return false;
+
+            pivot(r, q);
+            basis[r] = q;
+            status[q] = Basic;
+            status[leaving] = to_lower ? AtLower : AtUpper;
+            x[leaving] = to_lower ? lower[leaving] : upper[leaving];
+            update_basic_values();
+        }
+    }
+
+    double objective() const {
+        double v = 0.0;
+        for (int j = 0; j < vars; ++j) v += x[j];
+        return v;
+    }
+};
+
+// Per-worker buffers, reused from manual to manual
+struct Scratch {
+    DualSimplex lp;
+    std::vector<uint64_t> masks;
+    std::vector<int64_t> presses;
+    std::vector<int64_t> counters;
+    // exact engine
+    std::vector<__int128> matrix;
+    std::vector<int64_t> upper;
+    std::vector<int> pivot_col;
+    std::vector<int> free_vars;
+};
+
+// First structural variable with a fractional LP value, or -1 if the point is integral
+inline int fractional_var(const DualSimplex& lp) {
+    for (int j = 0; j < lp.vars; ++j) {
+        if (std::abs(lp.x[j] - std::round(lp.x[j])) > DualSimplex::EPS) return j;
+    }
+    return -1;
+}
+
+// Unfixed structural variable furthest from an integer, or -1 if every one is fixed
+inline int worst_rounded_var(const DualSimplex& lp) {
+    int k = -1;
+    double worst = -1.0;
+    for (int j = 0; j < lp.vars; ++j) {
+        const double off = std::abs(lp.x[j] - std::round(lp.x[j]));
+        if (lp.lower[j] < lp.upper[j] && off > worst) {
+            worst = off;
+            k = j;
+        }
+    }
+    return k;
+}
+
+/* A point that is integral within EPS but whose rounding misses the joltages still hides
+ * part of the tree. Split the least integral unfixed variable three ways instead: fixed to
+ * its rounding, below it and above it. The fixed branch has one free variable less, so this
+ * ends once every button is fixed. `visit` solves the node under the current bounds.
+ */
+template <typename Visit>
+void split_rounded(DualSimplex& lp, Visit&& visit) {
+    const int k = worst_rounded_var(lp);
+    if (k == -1) return; // every button fixed and the point still misses
+    const double r = std::clamp(std::round(lp.x[k]), lp.lower[k], lp.upper[k]);
+    const double lo = lp.lower[k];
+    const double hi = lp.upper[k];
+
+    lp.set_bounds(k, r, r);
+    visit();
+    if (lo <= r - 1.0) {
+        lp.set_bounds(k, lo, r - 1.0);
+        visit();
+    }
+    if (r + 1.0 <= hi) {
+        lp.set_bounds(k, r + 1.0, hi);
+        visit();
+    }
+    lp.set_bounds(k, lo, hi);
+}
+
+inline void report_stalled() {
+    std::println(stderr, "Simplex iteration cap reached, part 2 may not be minimal");
+}
+
+// Total presses of an integral LP point. The LP only ever sees doubles, so the rounded
+// point is checked against the joltages exactly before it may become an incumbent.
+inline std::optional<int64_t> verified_presses(const Manual& m, const DualSimplex& lp, Scratch& scratch) {
+    const int n = static_cast<int>(m.joltages.size());
+    std::vector<int64_t>& presses = scratch.presses;
+    std::vector<int64_t>& counters = scratch.counters;
+    presses.resize(lp.vars);
+    for (int j = 0; j < lp.vars; ++j) presses[j] = std::llround(lp.x[j]);
+
+    counters.assign(n, 0);
+    for (int j = 0; j < lp.vars; ++j) {
+        for (int idx : m.button(j)) {
+            if (idx >= 0 && idx < n) counters[idx] += presses[j];
+        }
+    }
+    if (!std::equal(counters.begin(), counters.end(), m.joltages.begin())) return std::nullopt;
+    return std::accumulate(presses.begin(), presses.end(), int64_t{0});
+}
+
+// Solve Part 2 via dual simplex + branch-and-bound ILP
+// Minimize sum of button presses. Branches only tighten the bounds of one variable and are
+// undone on the way back, so the whole search runs on a single tableau.
+inline int64_t solve_manual(const Manual& m, Scratch& scratch) {
+    AOC_PHASE("day10/branch-and-bound");
+    constexpr double EPS = DualSimplex::EPS;
+
+    const int n = static_cast<int>(m.joltages.size());
+    const int vars = static_cast<int>(m.button_count());
+    if (n == 0 || vars == 0) return 0;
+
+    DualSimplex& lp = scratch.lp;
+    lp.load(m);
+
+    int64_t best = std::numeric_limits<int64_t>::max();
+
+    auto branch = [&](auto&& self) -> void {
+        if (!lp.solve()) return;
+        const double val = lp.objective();
+        // the objective is integral, so a node can only improve if its ceiling does
+        if (static_cast<int64_t>(std::ceil(val - EPS)) >= best) return;
+
+        const int k = fractional_var(lp);
+        if (k == -1) {
+            if (auto total = verified_presses(m, lp, scratch)) {
+                best = *total;
+            } else {
+                split_rounded(lp, [&] { self(self); });
+            }
+            return;
+        }
+
+        const double v = std::floor(lp.x[k]);
+        const double lo = lp.lower[k];
+        const double hi = lp.upper[k];
+
+        lp.set_bounds(k, lo, v);
+        self(self);
+        lp.set_bounds(k, v + 1.0, hi);
+        self(self);
+        lp.set_bounds(k, lo, hi);
+    };
+
+    branch(branch);
+    if (lp.stalled) report_stalled();
+    // unreachable joltages contribute nothing
+    return (best == std::numeric_limits<int64_t>::max()) ? 0 : best;
+}
+
+/* Task-parallel variant of solve_manual for single hard manuals.
+ * The root LP is solved once and every worker starts from a copy of that tableau. Open
+ * nodes are just bound vectors, kept in a shared queue ordered by their parent's LP bound.
+ * A worker takes the best node, applies its bounds to its own tableau (a warm-started dual
+ * simplex as before) and dives depth-first. While other workers sit idle, it hands each right
+ * child to the queue instead of exploring it itself, so idle threads pick up subtrees. The
+ * incumbent is a shared atomic that every worker prunes against. The optimum is the same
+ * as the sequential search; only the order the tree is visited in changes.
+ */
+inline int64_t solve_manual_parallel(const Manual& m, unsigned threads) {
+    constexpr double EPS = DualSimplex::EPS;
+
+    const int n = static_cast<int>(m.joltages.size());
+    const int vars = static_cast<int>(m.button_count());
+    if (n == 0 || vars == 0) return 0;
+    if (threads <= 1) {
+        Scratch scratch;
+        return solve_manual(m, scratch);
+    }
+    AOC_PHASE("day10/branch-and-bound");
+
+    DualSimplex root;
+    root.load(m);
+    if (!root.solve()) {
+        if (root.stalled) report_stalled();
+        return 0;
+    }
+
+    struct Node {
+        double bound;
+        std::vector<double> lower;
+        std::vector<double> upper;
+    };
+    auto worse = [](const Node& a, const Node& b) { return a.bound > b.bound; };
+    std::priority_queue<Node, std::vector<Node>, decltype(worse)> open(worse);
+    open.push({root.objective(), {root.lower.begin(), root.lower.begin() + vars},
+               {root.upper.begin(), root.upper.begin() + vars}});
+
+    std::mutex lock;
+    std::condition_variable wake;
+    unsigned busy{0};                // workers holding a node, guarded by lock
+    std::atomic<unsigned> waiting{0}; // workers blocked on an empty queue
+    std::atomic<int64_t> best{std::numeric_limits<int64_t>::max()};
+    std::atomic<bool> stalled{false};
+
+    auto improves = [&](double bound) {
+        return static_cast<int64_t>(std::ceil(bound - EPS)) < best.load(std::memory_order_relaxed);
+    };
+
+    auto worker = [&] {
+        Scratch scratch;
+        scratch.lp = root;
+        DualSimplex& lp = scratch.lp;
+
+        auto branch = [&](auto&& self) -> void {
+            if (!lp.solve()) return;
+            const double val = lp.objective();
+            if (!improves(val)) return;
+
+            const int k = fractional_var(lp);
+            if (k == -1) {
+                if (auto total = verified_presses(m, lp, scratch)) {
+                    int64_t seen = best.load();
+                    while (*total < seen && !best.compare_exchange_weak(seen, *total)) {}
+                } else {
+                    split_rounded(lp, [&] { self(self); });
+                }
+                return;
+            }
+
+            const double v = std::floor(lp.x[k]);
+            const double lo = lp.lower[k];
+            const double hi = lp.upper[k];
+
+            lp.set_bounds(k, lo, v);
+            self(self);
+            if (waiting.load(std::memory_order_relaxed) > 0) {
+                Node right{val, {lp.lower.begin(), lp.lower.begin() + vars},
+                           {lp.upper.begin(), lp.upper.begin() + vars}};
+                right.lower[k] = v + 1.0;
+                right.upper[k] = hi;
+                {
+                    std::scoped_lock guard{lock};
+                    open.push(std::move(right));
+                }
+                wake.notify_one();
+            } else {
+                lp.set_bounds(k, v + 1.0, hi);
+                self(self);
+            }
+            lp.set_bounds(k, lo, hi);
+        };
+
+        while (true) {
+            Node node;
+            {
+                std::unique_lock guard{lock};
+                waiting++;
+                wake.wait(guard, [&] { return !open.empty() || busy == 0; });
+                waiting--;
+                if (open.empty()) { // nothing queued and nobody left to queue more
+                    if (lp.stalled) stalled.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                node = open.top();
+                open.pop();
+                busy++;
+            }
+
+            if (improves(node.bound)) {
+                for (int j = 0; j < vars; ++j) lp.set_bounds(j, node.lower[j], node.upper[j]);
+                branch(branch);
+            }
+
+            {
+                std::scoped_lock guard{lock};
+                busy--;
+            }
+            wake.notify_all();
+        }
+    };
+
+    {
+        std::vector<std::jthread> pool;
+        for (unsigned t = 0; t < threads; ++t) pool.emplace_back(worker);
+    }
+    if (stalled.load()) report_stalled();
+
+    const int64_t result = best.load();
+    return (result == std::numeric_limits<int64_t>::max()) ? 0 : result;
+}
+
+/* Solve Part 2 exactly in integer arithmetic.
+ * The counter equations A x = joltages are brought into reduced echelon form with
+ * fraction-free row operations (cross-multiply, then divide the row by its gcd), so every
+ * pivot row reads  d_r * x_pivot = rhs_r - sum_f c_rf * x_f  over the free buttons f.
+ * Only the free buttons are enumerated, usually zero to three of them. Every button is
+ * bounded by 0 <= x <= smallest joltage it feeds, and at every node the rows narrow the
+ * domains of the free buttons not fixed yet (interval propagation to a fixpoint). The
+ * objective is linear in the free buttons, so the narrowed domains also give a lower bound
+ * to prune against the incumbent.
+ * The rows are kept in __int128. The button columns stay within `coeff_limit`, the joltage
+ * column only within `rhs_limit`, so large joltages go through this engine as well; the
+ * limits leave room for every product of a coefficient and a press count in the search.
+ * Unreachable joltages give 0 like the simplex engine. An error means the engine declined
+ * (coefficients too large, or the free domains still span more than `search_limit`
+ * points after propagating at the root)
+ * and the caller should fall back to the simplex.
+ */
+inline std::expected<int64_t, std::string> solve_manual_exact(const Manual& m, Scratch& scratch) {
+    AOC_PHASE("day10/exact");
+    using wide = __int128;
+    constexpr wide coeff_limit = wide{1} << 40;
+    constexpr wide rhs_limit = wide{1} << 72;
+    constexpr wide objective_limit = wide{1} << 120;
+    constexpr wide search_limit = 100'000;
+    auto magnitude = [](wide v) { return v < 0 ? -v : v; };
+    auto gcd = [&](wide a, wide b) {
+        a = magnitude(a);
+        b = magnitude(b);
+        while (b != 0) a = std::exchange(b, a % b);
+        return a;
+    };
+
+    const int n = static_cast<int>(m.joltages.size());
+    const int vars = static_cast<int>(m.button_count());
+    if (n == 0 || vars == 0) return 0;
+
+    const int stride = vars + 1;
+    std::vector<wide>& M = scratch.matrix;
+    M.assign(static_cast<size_t>(n) * stride, 0);
+    auto at = [&](int r, int c) -> wide& { return M[static_cast<size_t>(r) * stride + c]; };
+
+    std::vector<int64_t>& upper = scratch.upper;
+    upper.assign(vars, std::numeric_limits<int64_t>::max());
+    for (int j = 0; j < vars; ++j) {
+        for (int idx : m.button(j)) {
+            if (idx < 0 || idx >= n) continue;
+            at(idx, j) += 1; // a counter listed twice counts twice, as in the simplex
+            upper[j] = std::min(upper[j], m.joltages[idx]);
+        }
+        if (upper[j] == std::numeric_limits<int64_t>::max()) upper[j] = 0; // feeds nothing
+    }
+    for (int i = 0; i < n; ++i) at(i, vars) = m.joltages[i];
+
+    auto normalize = [&](int r, int lead) {
+        wide g{0};
+        for (int c = 0; c <= vars; ++c) g = gcd(g, at(r, c));
+        if (g == 0) return;
+        if (at(r, lead) < 0) g = -g;
+        for (int c = 0; c <= vars; ++c) at(r, c) /= g;
+    };
+
+    // fraction-free Gauss-Jordan
+    std::vector<int>& pivot_col = scratch.pivot_col;
+    pivot_col.clear();
+    int rank{0};
+    for (int col = 0; col < vars && rank < n; ++col) {
+        int r = -1;
+        for (int i = rank; i < n; ++i) {
+            if (at(i, col) != 0 && (r == -1 || magnitude(at(i, col)) < magnitude(at(r, col)))) r = i;
+        }
+        if (r == -1) continue;
+        for (int c = 0; c <= vars; ++c) std::swap(at(r, c), at(rank, c));
+        normalize(rank, col);
+
+        for (int i = 0; i < n; ++i) {
+            if (i == rank || at(i, col) == 0) continue;
+            const wide g = gcd(at(rank, col), at(i, col));
+            const wide a = at(rank, col) / g;
+            const wide b = at(i, col) / g;
+            for (int c = 0; c <= vars; ++c) {
+                const wide v = a * at(i, c) - b * at(rank, c);
+                if (magnitude(v) > (c == vars ? rhs_limit : coeff_limit)) {
+                    return std::unexpected("coefficients too large");
+                }
+                at(i, c) = v;
+            }
+            normalize(i, col);
+        }
+        pivot_col.push_back(col);
+        ++rank;
+    }
+    for (int i = rank; i < n; ++i) {
+        if (at(i, vars) != 0) return 0; // 0 = c, joltages unreachable
+    }
+
+    std::vector<int>& free_vars = scratch.free_vars;
+    free_vars.clear();
+    for (int c = 0, k = 0; c < vars; ++c) {
+        if (k < rank && pivot_col[k] == c) {
+            ++k;
+        } else {
+            free_vars.push_back(c);
+        }
+    }
+    // narrow domains first, they prune the most per level
+    std::sort(free_vars.begin(), free_vars.end(), [&](int a, int b) { return upper[a] < upper[b]; });
+    const int f = static_cast<int>(free_vars.size());
+
+    // scaled objective: L * sum(x) = K + sum_f w_f * x_f with L = lcm of the pivots
+    wide L{1};
+    for (int r = 0; r < rank; ++r) {
+        L = L / gcd(L, at(r, pivot_col[r])) * at(r, pivot_col[r]);
+        if (L > coeff_limit) return std::unexpected("coefficients too large");
+    }
+    wide K{0};
+    std::vector<wide> w(f, L);
+    for (int r = 0; r < rank; ++r) {
+        const wide scale = L / at(r, pivot_col[r]);
+        K += scale * at(r, vars);
+        for (int k = 0; k < f; ++k) w[k] -= scale * at(r, free_vars[k]);
+    }
+    // the search adds up w_f * x_f over the free buttons next to K
+    for (int k = 0; k < f; ++k) {
+        const wide x_max = upper[free_vars[k]];
+        if (x_max != 0 && magnitude(w[k]) > objective_limit / (x_max * (f + 1))) {
+            return std::unexpected("coefficients too large");
+        }
+    }
+
+    auto floor_div = [](wide a, wide b) { wide q = a / b; return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q; };
+    auto ceil_div = [](wide a, wide b) { wide q = a / b; return (a % b != 0 && (a < 0) == (b < 0)) ? q + 1 : q; };
+
+    std::vector<wide> residual(rank);
+    for (int r = 0; r < rank; ++r) residual[r] = at(r, vars);
+
+    // domains of the free buttons, one slice of f entries per depth
+    std::vector<wide> dom_lo(static_cast<size_t>(f + 1) * f, 0);
+    std::vector<wide> dom_hi(static_cast<size_t>(f + 1) * f, 0);
+    for (int k = 0; k < f; ++k) dom_hi[k] = upper[free_vars[k]];
+
+    // Narrow the domains of the unfixed buttons k..f-1 until nothing changes: in every row
+    // the pivot d * x_p = R - sum c_j x_j has to stay within [0, d * upper_p] for some
+    // choice of the other buttons. Returns false if a domain runs empty.
+    auto propagate = [&](int k, wide* lo, wide* hi) {
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (int r = 0; r < rank; ++r) {
+                wide s_min{0}, s_max{0};
+                for (int j = k; j < f; ++j) {
+                    const wide c = at(r, free_vars[j]);
+                    s_min += std::min(c * lo[j], c * hi[j]);
+                    s_max += std::max(c * lo[j], c * hi[j]);
+                }
+                const wide d_u = wide{at(r, pivot_col[r])} * upper[pivot_col[r]];
+                if (residual[r] - s_max > d_u || residual[r] - s_min < 0) return false;
+
+                for (int j = k; j < f; ++j) {
+                    const wide c = at(r, free_vars[j]);
+                    if (c == 0) continue;
+                    const wide others_min = s_min - std::min(c * lo[j], c * hi[j]);
+                    const wide others_max = s_max - std::max(c * lo[j], c * hi[j]);
+                    const wide need_ge = residual[r] - others_max - d_u; // c * x >= need_ge
+                    const wide need_le = residual[r] - others_min;       // c * x <= need_le
+                    const wide new_lo = std::max(lo[j], c > 0 ? ceil_div(need_ge, c) : ceil_div(need_le, c));
+                    const wide new_hi = std::min(hi[j], c > 0 ? floor_div(need_le, c) : floor_div(need_ge, c));
+                    if (new_lo > new_hi) return false;
+                    if (new_lo != lo[j] || new_hi != hi[j]) {
+                        lo[j] = new_lo;
+                        hi[j] = new_hi;
+                        changed = true;
+                    }
+                }
+            }
+        }
+        return true;
+    };
+
+    if (!propagate(0, dom_lo.data(), dom_hi.data())) return 0;
+    wide space{1};
+    for (int k = 0; k < f; ++k) {
+        space *= dom_hi[k] - dom_lo[k] + 1;
+        if (space > search_limit) return std::unexpected("too many free buttons");
+    }
+
+    int64_t best = std::numeric_limits<int64_t>::max();
+
+    // `cost` is K plus the objective share of the free buttons fixed so far
+    auto search = [&](auto&& self, int k, wide cost, int64_t free_sum) -> void {
+        wide* lo = dom_lo.data() + static_cast<size_t>(k) * f; // no element when f == 0
+        wide* hi = dom_hi.data() + static_cast<size_t>(k) * f;
+        if (!propagate(k, lo, hi)) return;
+
+        // lower bound on the objective over the remaining domains, rounded up because it is integral
+        wide bound = cost;
+        for (int j = k; j < f; ++j) bound += std::min(w[j] * lo[j], w[j] * hi[j]);
+        if (best != std::numeric_limits<int64_t>::max() && ceil_div(bound, L) >= best) return;
+
+        if (k == f) {
+            int64_t total = free_sum;
+            for (int r = 0; r < rank; ++r) {
+                const wide d = at(r, pivot_col[r]);
+                if (residual[r] % d != 0) return;
+                total += static_cast<int64_t>(residual[r] / d);
+            }
+            best = std::min(best, total);
+            return;
+        }
+
+        // walk towards the cheaper end first so the incumbent improves early
+        const int var = free_vars[k];
+        const bool ascending = w[k] >= 0;
+        for (wide i = 0; i <= hi[k] - lo[k]; ++i) {
+            const int64_t x = static_cast<int64_t>(ascending ? lo[k] + i : hi[k] - i);
+            std::copy(lo, lo + f, lo + f);
+            std::copy(hi, hi + f, hi + f);
+            for (int r = 0; r < rank; ++r) residual[r] -= wide{at(r, var)} * x;
+            self(self, k + 1, cost + w[k] * x, free_sum + x);
+            for (int r = 0; r < rank; ++r) residual[r] += wide{at(r, var)} * x;
+        }
+    };
+    search(search, 0, K, 0);
+    return (best == std::numeric_limits<int64_t>::max()) ? 0 : best;
+}
+
+/* Canonical form of a manual, printed in the input syntax.
+ * Relabeling the counters (lights and joltages together) or reordering the buttons does not
+ * change either answer, so machines that only differ in that way should share a cache entry.
+ * Counters are ordered by a colour refinement: start from (light, joltage), then repeatedly
+ * add the colours of the buttons each counter sits on, until the classes stop splitting.
+ * Remaining ties keep the input order, so the occasional symmetric machine may miss the cache
+ * but two different machines can never share a key, since the key is the whole machine.
+ */
+inline std::string canonical_key(const Manual& m) {
+    const size_t count = m.joltages.size();
+    std::vector<int> perm(count);
+    std::iota(perm.begin(), perm.end(), 0);
+
+    if (static_cast<size_t>(m.len) == count) {
+        auto light = [&](size_t i) -> int64_t { return (m.lights >> (m.len - i - 1)) & 1; };
+        std::vector<std::vector<int64_t>> sig(count);
+        std::vector<int64_t> color(count);
+        auto recolor = [&] {
+            std::vector<std::vector<int64_t>> classes(sig);
+            std::sort(classes.begin(), classes.end());
+            classes.erase(std::unique(classes.begin(), classes.end()), classes.end());
+            for (size_t i = 0; i < count; ++i) {
+                color[i] = std::lower_bound(classes.begin(), classes.end(), sig[i]) - classes.begin();
+            }
+            return classes.size();
+        };
+
+        for (size_t i = 0; i < count; ++i) sig[i] = {light(i), m.joltages[i]};
+        size_t classes = recolor();
+        while (classes < count) {
+            for (size_t i = 0; i < count; ++i) sig[i] = {color[i]};
+            std::vector<std::vector<int64_t>> on_button;
+            for (const auto btn : m.buttons()) {
+                std::vector<int64_t> colors;
+                for (int idx : btn) {
+                    if (idx >= 0 && static_cast<size_t>(idx) < count) colors.push_back(color[idx]);
+                }
+                std::sort(colors.begin(), colors.end());
+                colors.push_back(-1); // separator
+                on_button.push_back(std::move(colors));
+            }
+            for (size_t i = 0; i < count; ++i) {
+                std::vector<std::vector<int64_t>> mine;
+                for (size_t b = 0; b < m.button_count(); ++b) {
+                    if (std::ranges::find(m.button(b), static_cast<int16_t>(i)) != m.button(b).end()) {
+                        mine.push_back(on_button[b]);
+                    }
+                }
+                std::sort(mine.begin(), mine.end());
+                for (const auto& c : mine) sig[i].insert(sig[i].end(), c.begin(), c.end());
+            }
+            const size_t refined = recolor();
+            if (refined == classes) break;
+            classes = refined;
+        }
+
+        std::vector<int> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return color[a] < color[b]; });
+        for (size_t k = 0; k < count; ++k) perm[order[k]] = static_cast<int>(k);
+    }
+
+    std::vector<std::vector<int>> buttons;
+    for (const auto btn : m.buttons()) {
+        std::vector<int> mapped;
+        for (int idx : btn) {
+            mapped.push_back((idx >= 0 && static_cast<size_t>(idx) < count) ? perm[idx] : idx);
+        }
+        std::sort(mapped.begin(), mapped.end());
+        buttons.push_back(std::move(mapped));
+    }
+    std::sort(buttons.begin(), buttons.end());
+
+    std::string key(m.len + 2, '.');
+    key.front() = '[';
+    key.back() = ']';
+    for (int i = 0; i < m.len; ++i) {
+        if ((m.lights >> (m.len - i - 1)) & 1) key[1 + (static_cast<size_t>(i) < count ? perm[i] : i)] = '#';
+    }
+    for (const auto& btn : buttons) {
+        key += " (";
+        for (size_t i = 0; i < btn.size(); ++i) {
+            if (i > 0) key += ',';
+            key += std::to_string(btn[i]);
+        }
+        key += ')';
+    }
+    std::vector<int64_t> joltages(count);
+    for (size_t i = 0; i < count; ++i) joltages[perm[i]] = m.joltages[i];
+    key += " {";
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) key += ',';
+        key += std::to_string(joltages[i]);
+    }
+    key += '}';
+    return key;
+}
+
+struct CachedSolution {
+    int32_t part1;
+    int64_t part2;
+};
+
+// Cache file: one "<part 1> <part 2> <canonical manual>" per line. A missing file is an empty cache.
+inline std::unordered_map<std::string, CachedSolution> load_cache(const std::filesystem::path& path) {
+    std::unordered_map<std::string, CachedSolution> cache;
+    std::ifstream file{path};
+    std::string line;
+    size_t line_number{0};
+    while (getline(file, line)) {
+        line_number++;
+        if (line.empty()) continue;
+        CachedSolution sol{};
+        const char* end = line.data() + line.size();
+        auto [p1, ec1] = std::from_chars(line.data(), end, sol.part1);
+        auto [p2, ec2] = (ec1 == std::errc() && p1 < end && *p1 == ' ')
+                             ? std::from_chars(p1 + 1, end, sol.part2)
+                             : std::from_chars_result{p1, std::errc::invalid_argument};
+        if (ec2 != std::errc() || end - p2 < 2 || *p2 != ' ') { // a separator and a non-empty manual
+            std::println(stderr, "Skipping invalid cache line {} in {}", line_number, path.string());
+            continue;
+        }
+        cache.insert_or_assign(std::string(p2 + 1, end), sol);
+    }
+    return cache;
+}
+
+inline bool save_cache(const std::filesystem::path& path, const std::unordered_map<std::string, CachedSolution>& cache) {
+    // sorted, so the file does not churn between runs
+    std::vector<const std::pair<const std::string, CachedSolution>*> entries;
+    for (const auto& entry : cache) entries.push_back(&entry);
+    std::sort(entries.begin(), entries.end(), [](auto* a, auto* b) { return a->first < b->first; });
+
+    std::ofstream file{path, std::ios::trunc};
+    for (const auto* entry : entries) {
+        file << entry->second.part1 << ' ' << entry->second.part2 << ' ' << entry->first << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+/* Work-stealing loop over the tasks [0, count). Every worker starts with a contiguous block
+ * of indices in its own deque, takes from the back of it and, once that is empty, steals
+ * from the front of the others. fn(task, worker) runs exactly once per task.
+ */
+template <typename Fn>
+inline void parallel_for_stealing(size_t count, unsigned threads, Fn&& fn) {
+    struct Queue {
+        std::mutex lock;
+        std::deque<size_t> tasks;
+    };
+    std::vector<Queue> queues(threads);
+    for (unsigned w = 0; w < threads; ++w) {
+        for (size_t t = count * w / threads; t < count * (w + 1) / threads; ++t) {
+            queues[w].tasks.push_back(t);
+        }
+    }
+
+    auto take = [&](unsigned w) -> std::optional<size_t> {
+        {
+            std::scoped_lock guard{queues[w].lock};
+            if (!queues[w].tasks.empty()) {
+                size_t t = queues[w].tasks.back();
+                queues[w].tasks.pop_back();
+                return t;
+            }
+        }
+        for (unsigned k = 1; k < threads; ++k) {
+            Queue& victim = queues[(w + k) % threads];
+            std::scoped_lock guard{victim.lock};
+            if (!victim.tasks.empty()) {
+                size_t t = victim.tasks.front();
+                victim.tasks.pop_front();
+                return t;
+            }
+        }
+        return std::nullopt; // tasks never get added, so all queues stay empty from here on
+    };
+
+    std::vector<std::jthread> pool;
+    for (unsigned w = 0; w < threads; ++w) {
+        pool.emplace_back([&, w] {
+            while (auto t = take(w)) fn(*t, w);
+        });
+    }
+}
+
+// Part 1: fewest presses that toggle every manual's lights into place, summed
+inline int64_t part1(const Input& file) {
+    AOC_PHASE("day10/part1");
+    std::vector<uint64_t> masks;
+    int64_t total{0};
+    for (const Manual& man : file->manuals) {
+        button_masks(man, masks);
+        total += min_presses_gf2(masks, man.lights, man.len).value_or(0);
+    }
+    return total;
+}
+
+// Part 2: fewest presses that reach every manual's joltages, summed. Uses the exact engine
+// and falls back to the simplex where it declines, on all cores.
+inline int64_t part2(const Input& file) {
+    AOC_PHASE("day10/part2");
+    const auto& manuals = file->manuals;
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int64_t> presses(manuals.size());
+    std::vector<Scratch> scratch(threads);
+    parallel_for_stealing(manuals.size(), threads, [&](size_t i, unsigned worker) {
+        auto exact = solve_manual_exact(manuals[i], scratch[worker]);
+        presses[i] = exact ? *exact : solve_manual(manuals[i], scratch[worker]);
+    });
+    return std::accumulate(presses.begin(), presses.end(), int64_t{0});
+}
+
+} // namespace day10
+
+template<>
+struct std::formatter<day10::Manual> : std::formatter<std::string> {
+    auto format(const day10::Manual& m, std::format_context& ctx) const {
+        auto out = std::format_to(ctx.out(), "len: {} [", m.len);
+        out = std::format_to(out, "{}", day10::getBinaryRep(m.lights, m.len));
+        out = std::format_to(out, "] ");
+        for (const auto btn : m.buttons()) {
+            out = std::format_to(out, "(");
+            for (size_t i = 0; i < btn.size(); ++i) {
+                if (i > 0) out = std::format_to(out, ",");
+                out = std::format_to(out, "{}", btn[i]);
+            }
+            out = std::format_to(out, ") ");
+        }
+        out = std::format_to(out, "{{");
+        for (size_t i = 0; i < m.joltages.size(); ++i) {
+            if (i > 0) out = std::format_to(out, ",");
+            out = std::format_to(out, "{}", m.joltages[i]);
+        }
+        return std::format_to(out, "}}");
+    }
+};
@@ -0,0 +1,41 @@
+// All day libraries behind one lookup, for the tools that pick a day at run time.
+
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "day01.hpp"
+#include "day02.hpp"
+#include "day03.hpp"
+#include "day04.hpp"
+#include "day05.hpp"
+#include "day06.hpp"
+#include "day07.hpp"
+#include "day08.hpp"
+#include "day09.hpp"
+#include "day10.hpp"
+
+namespace days {
+
+inline constexpr std::array<std::string_view, 10> names{"01", "02", "03", "04", "05", "06", "07", "08", "09", "10"};
+
+// Calls fn(parse, part1, part2) with the functions of the named day ("01" to "10"), returns
+// false for any other name
+template <typename Fn>
+bool with_day(std::string_view name, Fn&& fn) {
+    if (name == "01") fn(day01::parse, day01::part1, day01::part2);
+    else if (name == "02") fn(day02::parse, day02::part1, day02::part2);
+    else if (name == "03") fn(day03::parse, day03::part1, day03::part2);
+    else if (name == "04") fn(day04::parse, day04::part1, day04::part2);
+    else if (name == "05") fn(day05::parse, day05::part1, day05::part2);
+    else if (name == "06") fn(day06::parse, day06::part1, day06::part2);
+    else if (name == "07") fn(day07::parse, day07::part1, day07::part2);
+    else if (name == "08") fn(day08::parse, day08::part1, day08::part2);
+    else if (name == "09") fn(day09::parse, day09::part1, day09::part2);
+    else if (name == "10") fn(day10::parse, day10::part1, day10::part2);
+    else return false;
+    return true;
+}
+
+} // namespace days